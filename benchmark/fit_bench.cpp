@@ -0,0 +1,220 @@
+// Standalone micro-benchmarks of the FIT SDK decoding paths used by the extension.
+// Built without DuckDB, see benchmark/README.md.
+
+#include "fit_accumulator.hpp"
+#include "fit_decode.hpp"
+#include "fit_hr_mesg.hpp"
+#include "fit_mesg_listener.hpp"
+#include "fit_profile.hpp"
+#include "fit_record_mesg.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <new>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+// Heap allocations of the process, counted by the replaced global operator new
+static uint64_t allocations = 0;
+
+void *operator new(size_t size) {
+	allocations++;
+	void *pointer = malloc(size ? size : 1);
+	if (!pointer) {
+		throw std::bad_alloc();
+	}
+	return pointer;
+}
+
+void operator delete(void *pointer) noexcept {
+	free(pointer);
+}
+
+namespace {
+
+struct BenchContext {
+	std::vector<char> file;
+	int iterations;
+};
+
+struct BenchResult {
+	// Number of operations timed (lookups, messages, ...) and bytes processed, if any
+	uint64_t operations;
+	uint64_t bytes;
+};
+
+class CountingListener : public fit::MesgListener {
+public:
+	uint64_t count = 0;
+
+	void OnMesg(fit::Mesg &mesg) override {
+		(void)mesg;
+		count++;
+	}
+};
+
+// Global message and field number lookups as done for every decoded field
+BenchResult BenchProfileLookup(const BenchContext &context) {
+	BenchResult result = {0, 0};
+	uint64_t found = 0;
+
+	for (int i = 0; i < context.iterations; i++) {
+		for (int m = 0; m < fit::Profile::MESGS; m++) {
+			const fit::Profile::MESG &mesg = fit::Profile::mesgs[m];
+			for (FIT_UINT16 f = 0; f < mesg.numFields; f++) {
+				if (fit::Profile::GetField(mesg.num, mesg.fields[f].num) != NULL) {
+					found++;
+				}
+				result.operations++;
+			}
+		}
+	}
+
+	if (found != result.operations) {
+		fprintf(stderr, "profile_lookup: %llu of %llu lookups failed\n",
+		        (unsigned long long)(result.operations - found), (unsigned long long)result.operations);
+		exit(1);
+	}
+	return result;
+}
+
+// Full decode through std::istream, as for non-seekable inputs
+BenchResult BenchDecodeStream(const BenchContext &context) {
+	BenchResult result = {0, 0};
+	std::string contents(context.file.begin(), context.file.end());
+
+	for (int i = 0; i < context.iterations; i++) {
+		std::istringstream stream(contents);
+		CountingListener listener;
+		fit::Decode decode;
+		decode.Read(&stream, &listener, NULL, NULL);
+		result.operations += listener.count;
+		result.bytes += contents.size();
+	}
+	return result;
+}
+
+// Full decode of an in-memory buffer, as for mapped files
+BenchResult BenchDecodeBuffer(const BenchContext &context) {
+	BenchResult result = {0, 0};
+
+	for (int i = 0; i < context.iterations; i++) {
+		CountingListener listener;
+		fit::Decode decode;
+		decode.Read(context.file.data(), (FIT_UINT32)context.file.size(), &listener, NULL, NULL);
+		result.operations += listener.count;
+		result.bytes += context.file.size();
+	}
+	return result;
+}
+
+// Decode of an in-memory buffer that only wants record messages, every other message is skipped
+BenchResult BenchDecodeRecords(const BenchContext &context) {
+	BenchResult result = {0, 0};
+	std::unordered_set<FIT_UINT16> mesgNums = {FIT_MESG_NUM_RECORD};
+
+	for (int i = 0; i < context.iterations; i++) {
+		CountingListener listener;
+		fit::Decode decode;
+		decode.SetWantedMesgNums(mesgNums);
+		decode.Read(context.file.data(), (FIT_UINT32)context.file.size(), &listener, NULL, NULL);
+		result.operations += listener.count;
+		result.bytes += context.file.size();
+	}
+	return result;
+}
+
+// Accumulated components of the records of a cycling file with a power meter: accumulated_power,
+// total_cycles and distance of compressed_speed_distance, after the hr and lap fields the decoder
+// tracked first. Operations are records.
+BenchResult BenchAccumulate(const BenchContext &context) {
+	static const FIT_UINT32 RECORDS = 100000;
+	BenchResult result = {0, 0};
+	FIT_UINT32 checksum = 0;
+
+	for (int i = 0; i < context.iterations; i++) {
+		fit::Accumulator accumulator;
+		accumulator.Set(FIT_MESG_NUM_HR, fit::HrMesg::FieldDefNum::EventTimestamp, 0);
+		accumulator.Set(FIT_MESG_NUM_LAP, FIT_FIELD_NUM_TIMESTAMP, 0);
+
+		for (FIT_UINT32 record = 0; record < RECORDS; record++) {
+			checksum += accumulator.Accumulate(FIT_MESG_NUM_RECORD, fit::RecordMesg::FieldDefNum::AccumulatedPower,
+			                                   (record * 250) & 0xFFFF, 16);
+			checksum += accumulator.Accumulate(FIT_MESG_NUM_RECORD, fit::RecordMesg::FieldDefNum::TotalCycles,
+			                                   record & 0xFF, 8);
+			checksum += accumulator.Accumulate(FIT_MESG_NUM_RECORD, fit::RecordMesg::FieldDefNum::Distance,
+			                                   (record * 7) & 0xFFF, 12);
+		}
+		result.operations += RECORDS;
+	}
+
+	if (checksum == 0) {
+		fprintf(stderr, "accumulate: no value accumulated\n");
+		exit(1);
+	}
+	return result;
+}
+
+struct Benchmark {
+	const char *name;
+	BenchResult (*run)(const BenchContext &context);
+};
+
+const Benchmark BENCHMARKS[] = {
+    {"profile_lookup", BenchProfileLookup},
+    {"decode_stream", BenchDecodeStream},
+    {"decode_buffer", BenchDecodeBuffer},
+    {"decode_records", BenchDecodeRecords},
+    {"accumulate", BenchAccumulate},
+};
+
+} // namespace
+
+int main(int argc, char **argv) {
+	if (argc < 2) {
+		fprintf(stderr, "Usage: %s <file.fit> [iterations] [benchmark]\n", argv[0]);
+		return 1;
+	}
+
+	BenchContext context;
+	std::ifstream file(argv[1], std::ios::in | std::ios::binary);
+	if (!file.is_open()) {
+		fprintf(stderr, "Cannot open FIT file: %s\n", argv[1]);
+		return 1;
+	}
+	context.file.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	context.iterations = argc > 2 ? atoi(argv[2]) : 20;
+	const char *filter = argc > 3 ? argv[3] : NULL;
+
+	printf("%-16s %12s %12s %10s %10s\n", "benchmark", "operations", "ns/op", "MB/s", "allocs/op");
+	for (const Benchmark &benchmark : BENCHMARKS) {
+		if (filter && strcmp(filter, benchmark.name) != 0) {
+			continue;
+		}
+
+		uint64_t start_allocations = allocations;
+		auto start = std::chrono::steady_clock::now();
+		BenchResult result;
+		try {
+			result = benchmark.run(context);
+		} catch (const std::exception &e) {
+			fprintf(stderr, "%s: %s\n", benchmark.name, e.what());
+			return 1;
+		}
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		uint64_t run_allocations = allocations - start_allocations;
+
+		double ns_per_op = result.operations ? seconds * 1e9 / (double)result.operations : 0.0;
+		double mb_per_s = result.bytes ? (double)result.bytes / (1024.0 * 1024.0) / seconds : 0.0;
+		double allocs_per_op = result.operations ? (double)run_allocations / (double)result.operations : 0.0;
+		printf("%-16s %12llu %12.1f %10.1f %10.3f\n", benchmark.name, (unsigned long long)result.operations, ns_per_op,
+		       mb_per_s, allocs_per_op);
+	}
+	return 0;
+}
@@ -13,39 +13,58 @@
 
 namespace fit {
 
+const FIT_UINT32 Accumulator::EmptySlot = FIT_UINT32_INVALID;
+
 FIT_UINT32 Accumulator::Accumulate(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum, const FIT_UINT32 value,
                                    const FIT_UINT8 bits) {
-	int i;
-	AccumulatedField accumField;
+	return GetField(mesgNum, destFieldNum).Accumulate(value, bits);
+}
 
-	for (i = 0; i < (int)fields.size(); i++) {
-		accumField = fields.at(i);
-		if ((accumField.mesgNum == mesgNum) && (accumField.destFieldNum == destFieldNum))
-			break;
+void Accumulator::Set(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum, const FIT_UINT32 value) {
+	GetField(mesgNum, destFieldNum).Set(value);
+}
+
+AccumulatedField &Accumulator::GetField(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum) {
+	FIT_UINT32 mask = (FIT_UINT32)slots.size() - 1;
+
+	if (!slots.empty()) {
+		for (FIT_UINT32 slot = GetSlot(mesgNum, destFieldNum, slots.size()); slots[slot] != EmptySlot;
+		     slot = (slot + 1) & mask) {
+			AccumulatedField &field = fields[slots[slot]];
+			if ((field.mesgNum == mesgNum) && (field.destFieldNum == destFieldNum))
+				return field;
+		}
 	}
 
-	if (i == (int)fields.size()) {
-		fields.push_back(AccumulatedField(mesgNum, destFieldNum));
+	fields.push_back(AccumulatedField(mesgNum, destFieldNum));
+
+	if ((fields.size() * 2) > slots.size()) {
+		// Grow and index every field again
+		slots.assign(slots.empty() ? 8 : slots.size() * 2, EmptySlot);
+		for (FIT_UINT32 i = 0; i < (FIT_UINT32)fields.size(); i++)
+			InsertSlot(i);
+	} else {
+		InsertSlot((FIT_UINT32)fields.size() - 1);
 	}
 
-	return fields[i].Accumulate(value, bits);
+	return fields.back();
 }
 
-void Accumulator::Set(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum, const FIT_UINT32 value) {
-	int i;
-	AccumulatedField accumField;
+void Accumulator::InsertSlot(FIT_UINT32 fieldIndex) {
+	FIT_UINT32 mask = (FIT_UINT32)slots.size() - 1;
+	FIT_UINT32 slot = GetSlot(fields[fieldIndex].mesgNum, fields[fieldIndex].destFieldNum, slots.size());
 
-	for (i = 0; i < (int)fields.size(); i++) {
-		accumField = fields.at(i);
-		if ((accumField.mesgNum == mesgNum) && (accumField.destFieldNum == destFieldNum))
-			break;
-	}
+	while (slots[slot] != EmptySlot)
+		slot = (slot + 1) & mask;
 
-	if (i == (int)fields.size()) {
-		accumField = AccumulatedField(mesgNum, destFieldNum);
-		fields.push_back(accumField);
-	}
-	fields[i].Set(value);
+	slots[slot] = fieldIndex;
+}
+
+FIT_UINT32 Accumulator::GetSlot(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum, size_t numSlots) {
+	FIT_UINT32 key = ((FIT_UINT32)mesgNum << 8) | destFieldNum;
+
+	// Fibonacci hashing spreads the consecutive field numbers of a message
+	return (FIT_UINT32)((key * 2654435769u) >> 16) & ((FIT_UINT32)numSlots - 1);
 }
 
 } // namespace fit
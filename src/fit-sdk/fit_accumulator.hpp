@@ -24,7 +24,16 @@ public:
 	void Set(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum, const FIT_UINT32 value);
 
 private:
+	static const FIT_UINT32 EmptySlot;
+
 	std::vector<AccumulatedField> fields;
+	// Open addressed index of fields by (mesgNum, destFieldNum), a power of two in size and
+	// at most half full. Slots hold an index into fields or EmptySlot.
+	std::vector<FIT_UINT32> slots;
+
+	AccumulatedField &GetField(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum);
+	void InsertSlot(FIT_UINT32 fieldIndex);
+	static FIT_UINT32 GetSlot(const FIT_UINT16 mesgNum, const FIT_UINT8 destFieldNum, size_t numSlots);
 };
 
 } // namespace fit
@@ -32,11 +32,56 @@ FIT_UINT16 CRC::Get16(FIT_UINT16 crc, FIT_UINT8 byte) {
 }
 
 FIT_UINT16 CRC::Calc16(const volatile void *data, FIT_UINT32 size) {
-	FIT_UINT16 crc = 0;
-	FIT_BYTE *data_ptr = (FIT_BYTE *)data;
+	return CRC::Update16(0, (const void *)data, size);
+}
+
+namespace {
+
+// Slicing-by-8 tables for the reflected CRC-16 (polynomial 0xA001) used by FIT.
+// table[0] is the classic byte table, table[k] advances a byte through k more zero bytes.
+struct CRC16Tables {
+	FIT_UINT16 table[8][256];
+
+	CRC16Tables() {
+		for (int i = 0; i < 256; i++) {
+			FIT_UINT16 crc = (FIT_UINT16)i;
+
+			for (int bit = 0; bit < 8; bit++)
+				crc = (crc & 1) ? (FIT_UINT16)((crc >> 1) ^ 0xA001) : (FIT_UINT16)(crc >> 1);
+
+			table[0][i] = crc;
+		}
+
+		for (int i = 0; i < 256; i++) {
+			for (int k = 1; k < 8; k++)
+				table[k][i] = (FIT_UINT16)((table[k - 1][i] >> 8) ^ table[0][table[k - 1][i] & 0xFF]);
+		}
+	}
+};
+
+const CRC16Tables &GetCRC16Tables() {
+	static const CRC16Tables tables;
+	return tables;
+}
+
+} // namespace
+
+FIT_UINT16 CRC::Update16(FIT_UINT16 crc, const void *data, FIT_UINT32 size) {
+	const FIT_UINT16(*table)[256] = GetCRC16Tables().table;
+	const FIT_UINT8 *data_ptr = (const FIT_UINT8 *)data;
+
+	while (size >= 8) {
+		FIT_UINT8 b0 = (FIT_UINT8)(data_ptr[0] ^ (crc & 0xFF));
+		FIT_UINT8 b1 = (FIT_UINT8)(data_ptr[1] ^ (crc >> 8));
+
+		crc = table[7][b0] ^ table[6][b1] ^ table[5][data_ptr[2]] ^ table[4][data_ptr[3]] ^ table[3][data_ptr[4]] ^
+		      table[2][data_ptr[5]] ^ table[1][data_ptr[6]] ^ table[0][data_ptr[7]];
+		data_ptr += 8;
+		size -= 8;
+	}
 
 	while (size) {
-		crc = CRC::Get16(crc, *data_ptr);
+		crc = (FIT_UINT16)((crc >> 8) ^ table[0][(crc ^ *data_ptr) & 0xFF]);
 		data_ptr++;
 		size--;
 	}
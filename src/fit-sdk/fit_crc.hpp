@@ -20,6 +20,17 @@ class CRC {
 public:
 	static FIT_UINT16 Get16(FIT_UINT16 crc, FIT_UINT8 byte);
 	static FIT_UINT16 Calc16(const volatile void *data, FIT_UINT32 size);
+	static FIT_UINT16 Update16(FIT_UINT16 crc, const void *data, FIT_UINT32 size);
+	///////////////////////////////////////////////////////////////////////
+	// Continues a CRC over a whole buffer. Uses slicing-by-8 lookup tables
+	// to process eight bytes per step. Gives the same result as calling
+	// Get16() for every byte.
+	// Parameters:
+	//    crc      CRC of the preceding bytes (0 to start).
+	//    data     Pointer to the bytes to add.
+	//    size     Number of bytes.
+	// Returns the updated CRC.
+	///////////////////////////////////////////////////////////////////////
 };
 
 } // namespace fit
@@ -9,6 +9,7 @@
 // Tag = production/release/21.171.0-0-g57fed75
 /////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
 #include "fit_decode.hpp"
@@ -27,17 +28,30 @@ Decode::Decode() : mesgListener(NULL), mesgDefinitionListener(NULL) {
 	for (int i = 0; i < FIT_MAX_LOCAL_MESGS; i++) {
 		localMesgDefs[i] = MesgDefinition();
 		localMesgDefs[i].SetLocalNum((FIT_UINT8)i);
+		localMesgSizes[i] = FIT_UINT32_INVALID;
+		localMesgRaw[i] = FIT_FALSE;
+		localMesgSkipped[i] = FIT_FALSE;
+		localTimestampOffsets[i] = FIT_UINT32_INVALID;
 	}
 
+	mesg = &localMesgs[0];
 	headerException = "";
 	streamIsComplete = FIT_TRUE;
 	skipHeader = FIT_FALSE;
 	invalidDataSize = FIT_FALSE;
 	file = NULL;
+	source = NULL;
+	sourceSize = 0;
+	sourceOffset = 0;
+	readBuffer = (const FIT_UINT8 *)buffer;
 	currentByteOffset = 0;
+	nextInterruptCheck = 0;
 	bytesRead = 0;
 	currentByteIndex = 0;
 	suppressComponentExpansion = FIT_FALSE;
+	suppressCrcCheck = FIT_FALSE;
+	rawMesgListener = NULL;
+	interrupt = NULL;
 }
 
 FIT_BOOL Decode::IsFIT(std::istream &file) {
@@ -76,7 +90,10 @@ FIT_BOOL Decode::IsFIT(std::istream &file) {
 
 FIT_BOOL Decode::CheckIntegrity(std::istream &file) {
 	FIT_BOOL status = FIT_TRUE;
+	FIT_BOOL suppressCrc = suppressCrcCheck;
 
+	// The integrity check always verifies the CRC.
+	suppressCrcCheck = FIT_FALSE;
 	InitRead(file);
 
 	try {
@@ -115,13 +132,52 @@ FIT_BOOL Decode::CheckIntegrity(std::istream &file) {
 	}
 
 	InitRead(file);
+	suppressCrcCheck = suppressCrc;
+
+	return status;
+}
+
+FIT_BOOL Decode::CheckIntegrity(const void *data, FIT_UINT32 size) {
+	const FIT_UINT8 *bytes = (const FIT_UINT8 *)data;
+	FIT_BOOL status = FIT_TRUE;
+	FIT_BOOL suppressCrc = suppressCrcCheck;
+	FIT_UINT32 i;
+
+	// The integrity check always verifies the CRC.
+	suppressCrcCheck = FIT_FALSE;
+	InitRead();
+
+	try {
+		for (i = 0; (i < size) && (status == FIT_TRUE); i++) {
+			switch (ReadByte(bytes[i])) {
+			case RETURN_CONTINUE:
+			case RETURN_MESG:
+			case RETURN_MESG_DEF:
+				break;
+
+			case RETURN_END_OF_FILE:
+				InitRead();
+				break;
+
+			default:
+				status = FIT_FALSE;
+				break;
+			}
+		}
+	} catch (const RuntimeException &) {
+		// Fall through and return failure.
+		status = FIT_FALSE;
+	}
+
+	InitRead();
+	suppressCrcCheck = suppressCrc;
 
 	return status;
 }
 
 void Decode::SkipHeader() {
 	// Do not allow changing the settings after Read has started.
-	if (file != NULL) {
+	if ((file != NULL) || (source != NULL)) {
 		throw RuntimeException("Can't set skipHeader option after Decode started!");
 	}
 	// Skip header decode
@@ -132,7 +188,7 @@ void Decode::SkipHeader() {
 
 void Decode::IncompleteStream() {
 	// Do not allow changing the settings after Read has started.
-	if (file != NULL) {
+	if ((file != NULL) || (source != NULL)) {
 		throw RuntimeException("Can't set incompleteStream option after Decode started!");
 	}
 	// Don't raise an error if eof is encountered during decode,
@@ -145,7 +201,9 @@ FIT_BOOL Decode::Read(std::istream *file) {
 	FIT_UINT32 fileSize = 0;
 
 	this->file = file;
+	source = NULL;
 	currentByteOffset = 0;
+	nextInterruptCheck = 0;
 	descriptions.clear();
 	developers.clear();
 
@@ -172,6 +230,34 @@ FIT_BOOL Decode::Read(std::istream *file, MesgListener *mesgListener, MesgDefini
 	return Read(file);
 }
 
+FIT_BOOL Decode::Read(const void *data, FIT_UINT32 size, MesgListener *mesgListener,
+                      MesgDefinitionListener *definitionListener,
+                      DeveloperFieldDescriptionListener *descriptionListener) {
+	FIT_BOOL status = FIT_TRUE;
+
+	this->mesgListener = mesgListener;
+	this->mesgDefinitionListener = definitionListener;
+	this->descriptionListener = descriptionListener;
+
+	file = NULL;
+	source = (const FIT_UINT8 *)data;
+	sourceSize = size;
+	sourceOffset = 0;
+	currentByteOffset = 0;
+	nextInterruptCheck = 0;
+	currentByteIndex = 0;
+	bytesRead = 0;
+	descriptions.clear();
+	developers.clear();
+
+	if (currentByteOffset < size) {
+		InitRead();
+		status = Resume();
+	}
+
+	return status;
+}
+
 FIT_BOOL Decode::Read(std::istream &file, MesgListener &mesgListener) {
 	return Read(&file, &mesgListener, nullptr, nullptr);
 }
@@ -185,65 +271,63 @@ void Decode::Pause(void) {
 }
 
 FIT_BOOL Decode::Resume(void) {
+	FIT_BOOL status = ResumeFile();
+
+	// A memory buffer may chain several FIT files, decoding carries on with the next one so that
+	// a paused decode resumes across them
+	while ((source != NULL) && (status == FIT_TRUE) && (currentByteOffset < sourceSize)) {
+		InitRead();
+		status = ResumeFile();
+	}
+
+	return status;
+}
+
+FIT_BOOL Decode::ResumeFile(void) {
 	pause = FIT_FALSE;
 	RETURN decodeReturn = RETURN_CONTINUE;
 
 	do {
 		if (currentByteIndex == 0) {
-			file->read(buffer, BufferSize);
-			bytesRead = (FIT_UINT32)file->gcount();
+			FillBuffer();
 		}
 
 		for (; currentByteIndex < bytesRead; currentByteIndex++) {
 			if (pause)
 				return FIT_FALSE;
 
-			decodeReturn = ReadByte((FIT_UINT8)buffer[currentByteIndex]);
+			// The interrupt flag is checked between buffers and every InterruptCheckInterval bytes
+			// of a buffer, as a memory buffer is handed over whole
+			if (currentByteOffset >= nextInterruptCheck) {
+				if ((interrupt != NULL) && interrupt->load(std::memory_order_relaxed))
+					return FIT_FALSE;
+				nextInterruptCheck = currentByteOffset + InterruptCheckInterval;
+			}
+
+			// Fast path: decode and dispatch a whole data message straight from the buffer
+			// when it is fully available. Definitions, partial messages and the file CRC fall
+			// back to the byte state machine below.
+			if (state == STATE_RECORD) {
+				FIT_UINT32 mesgSize = ReadMesg(&readBuffer[currentByteIndex], bytesRead - currentByteIndex);
+
+				if (mesgSize > 0) {
+					decodeReturn = RETURN_MESG;
+					currentByteIndex += mesgSize - 1;
+					currentByteOffset += mesgSize;
+					continue;
+				}
+			}
+
+			decodeReturn = ReadByte(readBuffer[currentByteIndex]);
 
 			switch (decodeReturn) {
 			case RETURN_CONTINUE:
 				break;
 
 			case RETURN_MESG:
-				if (mesg.GetNum() == FIT_MESG_NUM_DEVELOPER_DATA_ID) {
-					DeveloperDataIdMesg devIdMesg(mesg);
-
-					if (!devIdMesg.IsDeveloperDataIndexValid()) {
-						throw fit::RuntimeException("Invalid developer data index in DeveloperDataIdMesg");
-					}
-
-					FIT_UINT8 index = devIdMesg.GetDeveloperDataIndex();
-					developers[index] = devIdMesg;
-					descriptions[index] = std::unordered_map<FIT_UINT8, FieldDescriptionMesg>();
-				} else if (mesg.GetNum() == FIT_MESG_NUM_FIELD_DESCRIPTION) {
-					FieldDescriptionMesg descMesg(mesg);
-
-					if (!descMesg.IsDeveloperDataIndexValid()) {
-						throw fit::RuntimeException("Invalid developer data index in FieldDescriptionMesg");
-					}
-
-					if (!descMesg.IsFieldDefinitionNumberValid()) {
-						throw fit::RuntimeException(
-						    "Invalid developer field definition number in FieldDescriptionMesg");
-					}
-
-					FIT_UINT8 index = descMesg.GetDeveloperDataIndex();
-					FIT_UINT8 fldNum = descMesg.GetFieldDefinitionNumber();
-
-					try {
-						descriptions.at(index)[fldNum] = descMesg;
-
-						if (descriptionListener) {
-							descriptionListener->OnDeveloperFieldDescription(
-							    DeveloperFieldDescription(descMesg, developers[index]));
-						}
-					} catch (std::out_of_range) {
-						// Description without a Developer Data Id Message
-					}
-				}
-
-				if (mesgListener)
-					mesgListener->OnMesg(mesg);
+				// Skipped messages only go through here when split across stream buffers
+				if (!localMesgSkipped[localMesgIndex])
+					DispatchMesg();
 				break;
 
 			case RETURN_MESG_DEF:
@@ -266,7 +350,7 @@ FIT_BOOL Decode::Resume(void) {
 			currentByteOffset++;
 		}
 		currentByteIndex = 0;
-	} while (file->good());
+	} while (MoreData());
 
 	if ((streamIsComplete == FIT_TRUE) && (skipHeader == FIT_FALSE)) {
 		// When decoding a complete file we should exit via RETURN_END_OF_FILE state only.
@@ -316,7 +400,7 @@ void Decode::InitRead(std::istream &file) {
 	InitRead(file, FIT_TRUE);
 }
 
-void Decode::InitRead(std::istream &file, FIT_BOOL startOfFile) {
+void Decode::InitRead(void) {
 	fileBytesLeft = 3; // Header byte + CRC.
 	fileHdrOffset = 0;
 	crc = 0;
@@ -326,6 +410,10 @@ void Decode::InitRead(std::istream &file, FIT_BOOL startOfFile) {
 	if (skipHeader == FIT_FALSE)
 		state = STATE_FILE_HDR;
 	lastTimeOffset = 0;
+}
+
+void Decode::InitRead(std::istream &file, FIT_BOOL startOfFile) {
+	InitRead();
 
 	// Reset to the beginning of the file
 	if (startOfFile == FIT_TRUE) {
@@ -335,6 +423,26 @@ void Decode::InitRead(std::istream &file, FIT_BOOL startOfFile) {
 	file.clear(); // workaround libc++ issue
 }
 
+void Decode::FillBuffer(void) {
+	if (file != NULL) {
+		file->read(buffer, BufferSize);
+		bytesRead = (FIT_UINT32)file->gcount();
+		readBuffer = (const FIT_UINT8 *)buffer;
+	} else {
+		// The whole remaining memory buffer is handed to the decoder at once.
+		readBuffer = source + sourceOffset;
+		bytesRead = sourceSize - sourceOffset;
+		sourceOffset = sourceSize;
+	}
+}
+
+FIT_BOOL Decode::MoreData(void) const {
+	if (file != NULL)
+		return file->good();
+
+	return (sourceOffset < sourceSize);
+}
+
 void Decode::UpdateEndianness(FIT_UINT8 type, FIT_UINT8 size) {
 	FIT_UINT8 typeSize = baseTypeSizes[type & FIT_BASE_TYPE_NUM_MASK];
 	FIT_UINT8 numElements = size / typeSize;
@@ -354,7 +462,8 @@ void Decode::UpdateEndianness(FIT_UINT8 type, FIT_UINT8 size) {
 
 Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 	if ((fileBytesLeft > 0) && (skipHeader == FIT_FALSE)) {
-		crc = CRC::Get16(crc, data);
+		if (suppressCrcCheck == FIT_FALSE)
+			crc = CRC::Get16(crc, data);
 
 		fileBytesLeft--;
 
@@ -373,7 +482,7 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 
 		if (fileBytesLeft == 0) // CRC high byte.
 		{
-			if (crc != 0) {
+			if ((crc != 0) && (suppressCrcCheck == FIT_FALSE)) {
 				std::ostringstream message;
 				message << "FIT decode error: File CRC failed. Error at byte: " << currentByteOffset;
 				throw(RuntimeException(message.str()));
@@ -498,9 +607,10 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 					throw(RuntimeException(message.str()));
 				}
 
-				mesg = Mesg(localMesgDefs[localMesgIndex].GetNum());
-				mesg.SetLocalNum(localMesgIndex);
-				mesg.AddField(timestampField);
+				mesg = &localMesgs[localMesgIndex];
+				mesg->Reset(localMesgDefs[localMesgIndex].GetNum());
+				mesg->SetLocalNum(localMesgIndex);
+				mesg->AddField(timestampField);
 
 				if (localMesgDefs[localMesgIndex].GetFields().size() == 0)
 					return RETURN_MESG;
@@ -520,8 +630,9 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 						throw(RuntimeException(message.str()));
 					}
 
-					mesg = Mesg(localMesgDefs[localMesgIndex].GetNum());
-					mesg.SetLocalNum(localMesgIndex);
+					mesg = &localMesgs[localMesgIndex];
+					mesg->Reset(localMesgDefs[localMesgIndex].GetNum());
+					mesg->SetLocalNum(localMesgIndex);
 
 					if (localMesgDefs[localMesgIndex].GetFields().size() != 0) {
 						state = STATE_FIELD_DATA;
@@ -540,6 +651,9 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 
 	case STATE_RESERVED1:
 		localMesgDefs[localMesgIndex].ClearFields();
+		localMesgSizes[localMesgIndex] = FIT_UINT32_INVALID;
+		localMesgRaw[localMesgIndex] = FIT_FALSE;
+		localMesgSkipped[localMesgIndex] = FIT_FALSE;
 		state = STATE_ARCH;
 		break;
 
@@ -580,6 +694,7 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 				state = STATE_NUM_DEV_FIELDS;
 			} else {
 				state = STATE_RECORD;
+				UpdateMesgSize();
 				return RETURN_MESG_DEF;
 			}
 		} else {
@@ -613,6 +728,7 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 				state = STATE_NUM_DEV_FIELDS;
 			} else {
 				state = STATE_RECORD;
+				UpdateMesgSize();
 				return RETURN_MESG_DEF;
 			}
 		} else {
@@ -626,6 +742,7 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 
 		if (numFields == 0) {
 			state = STATE_RECORD;
+			UpdateMesgSize();
 			return RETURN_MESG_DEF;
 		}
 
@@ -660,6 +777,7 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 
 		if (++fieldIndex >= numFields) {
 			state = STATE_RECORD;
+			UpdateMesgSize();
 			return RETURN_MESG_DEF;
 		}
 
@@ -680,91 +798,12 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 		fieldBytesLeft--;
 
 		if (fieldBytesLeft == 0) {
-			MesgDefinition defn = localMesgDefs[localMesgIndex];
-			FieldDefinition *fldDefn = defn.GetFieldByIndex(fieldIndex);
-			FIT_UINT8 baseType = fldDefn->GetType() & FIT_BASE_TYPE_NUM_MASK;
-			FIT_UINT8 typeSize = baseTypeSizes[baseType];
-			FIT_BOOL read = FIT_TRUE;
-
-			if (baseType < FIT_BASE_TYPES) // Ignore field if base type not supported.
-			{
-				UpdateEndianness(fldDefn->GetType(), fldDefn->GetSize());
-
-				Field field(mesg.GetNum(), fldDefn->GetNum());
-				if (field.IsValid()) // If known field type.
-				{
-					if (field.GetType() != fldDefn->GetType()) {
-						FIT_UINT8 profileSize = fit::baseTypeSizes[(field.GetType() & FIT_BASE_TYPE_NUM_MASK)];
-						if (typeSize < profileSize) {
-							field.SetBaseType(fldDefn->GetType());
-						} else if (typeSize != profileSize) {
-							// Demotion is hard. Don't read the field if the
-							// sizes are different. Use the profile type if the
-							// signedness of the field has changed.
-							read = FIT_FALSE;
-						}
-					}
-
-					if (read) {
-						field.Read(&fieldData, defn.GetFieldByIndex(fieldIndex)->GetSize());
-					}
-
-					// The special case time record.
-					if (defn.GetFieldByIndex(fieldIndex)->GetNum() == FIT_FIELD_NUM_TIMESTAMP) {
-						timestamp = field.GetUINT32Value();
-						lastTimeOffset = (FIT_UINT8)(timestamp & FIT_HDR_TIME_OFFSET_MASK);
-					}
-
-					// Allows messages containing the accumulated field to set the accumulated value
-					if (field.GetIsAccumulated()) {
-						FIT_UINT8 i;
-						for (i = 0; i < field.GetNumValues(); i++) {
-							FIT_FLOAT64 value = field.GetRawValue(i);
-							FIT_UINT16 j;
-							for (j = 0; j < mesg.GetNumFields(); j++) {
-								FIT_UINT16 k;
-								Field *containingField = mesg.GetFieldByIndex(j);
-								FIT_UINT16 numComponents = containingField->GetNumComponents();
-
-								for (k = 0; k < numComponents; k++) {
-									const Profile::FIELD_COMPONENT *fc = containingField->GetComponent(k);
-									if ((fc->num == field.GetNum()) && (fc->accumulate)) {
-										value = ((((value / field.GetScale()) - field.GetOffset()) + fc->offset) *
-										         fc->scale);
-									}
-								}
-							}
-							accumulator.Set(mesg.GetNum(), field.GetNum(), (FIT_UINT32)value);
-						}
-					}
-
-					if (field.GetNumValues() > 0) {
-						mesg.AddField(field);
-					}
-				}
-			}
+			ReadFieldData(*localMesgDefs[localMesgIndex].GetFieldByIndex(fieldIndex));
 			fieldIndex++;
 		}
 
 		if (fieldIndex >= localMesgDefs[localMesgIndex].GetFields().size()) {
-			// Now that the entire message is decoded we may evaluate subfields and expand components
-			for (FIT_UINT16 i = 0; i < mesg.GetNumFields(); i++) {
-				FIT_UINT16 activeSubField = mesg.GetActiveSubFieldIndexByFieldIndex(i);
-				if (!suppressComponentExpansion) {
-					if (activeSubField == FIT_SUBFIELD_INDEX_MAIN_FIELD) {
-						if (mesg.GetFieldByIndex(i)->GetNumComponents() > 0) {
-							ExpandComponents(mesg.GetFieldByIndex(i), mesg.GetFieldByIndex(i)->GetComponent(0),
-							                 mesg.GetFieldByIndex(i)->GetNumComponents());
-						}
-					} else {
-						if (mesg.GetFieldByIndex(i)->GetSubField(activeSubField)->numComponents > 0) {
-							ExpandComponents(mesg.GetFieldByIndex(i),
-							                 mesg.GetFieldByIndex(i)->GetSubField(activeSubField)->components,
-							                 mesg.GetFieldByIndex(i)->GetSubField(activeSubField)->numComponents);
-						}
-					}
-				}
-			}
+			ExpandMesgComponents();
 
 			if (localMesgDefs[localMesgIndex].GetDeveloperFieldTotalSize() > 0) {
 				fieldIndex = 0;
@@ -794,19 +833,7 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 		fieldBytesLeft--;
 
 		if (fieldBytesLeft == 0) {
-			MesgDefinition defn = localMesgDefs[localMesgIndex];
-			DeveloperFieldDefinition *fldDefn = defn.GetDevFieldByIndex(fieldIndex);
-			FIT_UINT8 baseType = fldDefn->GetType() & FIT_BASE_TYPE_NUM_MASK;
-
-			if (baseType < FIT_BASE_TYPES) // Ignore field if base type not supported.
-			{
-				DeveloperField field(*fldDefn);
-
-				UpdateEndianness(fldDefn->GetType(), fldDefn->GetSize());
-				field.Read(&fieldData, fldDefn->GetSize());
-				mesg.AddDeveloperField(field);
-			}
-
+			ReadDevFieldData(*localMesgDef.GetDevFieldByIndex(fieldIndex));
 			fieldIndex++;
 
 			if (fieldIndex >= localMesgDef.GetDevFields().size()) {
@@ -825,21 +852,482 @@ Decode::RETURN Decode::ReadByte(FIT_UINT8 data) {
 	return RETURN_CONTINUE;
 }
 
+void Decode::UpdateMesgSize(void) {
+	const MesgDefinition &defn = localMesgDefs[localMesgIndex];
+	FIT_UINT32 size = 0;
+
+	localMesgSizes[localMesgIndex] = FIT_UINT32_INVALID;
+	localMesgRaw[localMesgIndex] = FIT_FALSE;
+	localMesgSkipped[localMesgIndex] = FIT_FALSE;
+
+	if (defn.GetNum() == FIT_MESG_NUM_INVALID)
+		return; // Data messages must go through the state machine to raise the missing definition error.
+
+	for (size_t i = 0; i < defn.GetFields().size(); i++)
+		size += defn.GetFields()[i].GetSize();
+
+	for (size_t i = 0; i < defn.GetDevFields().size(); i++) {
+		if (defn.GetDevFields()[i].GetSize() == 0)
+			return; // Leave empty developer fields to the state machine.
+		size += defn.GetDevFields()[i].GetSize();
+	}
+
+	localMesgSizes[localMesgIndex] = size;
+	if (!UpdateSkippedMesg())
+		UpdateRawMesg();
+}
+
+FIT_BOOL Decode::UpdateSkippedMesg(void) {
+	const MesgDefinition &defn = localMesgDefs[localMesgIndex];
+	FIT_UINT32 timestampOffset = FIT_UINT32_INVALID;
+	FIT_UINT32 offset = 0;
+
+	if (wantedMesgNums.empty() || (wantedMesgNums.count(defn.GetNum()) != 0))
+		return FIT_FALSE;
+
+	// Developer data messages are needed by the decoder itself.
+	if ((defn.GetNum() == FIT_MESG_NUM_DEVELOPER_DATA_ID) || (defn.GetNum() == FIT_MESG_NUM_FIELD_DESCRIPTION))
+		return FIT_FALSE;
+
+	// The timestamp of a skipped message is still the base of the compressed timestamps that follow.
+	for (size_t i = 0; i < defn.GetFields().size(); i++) {
+		const FieldDefinition &fieldDef = defn.GetFields()[i];
+
+		if (fieldDef.GetNum() == FIT_FIELD_NUM_TIMESTAMP) {
+			// Only a plain uint32 timestamp can be read without the profile.
+			if (((fieldDef.GetType() & FIT_BASE_TYPE_NUM_MASK) >= FIT_BASE_TYPES) ||
+			    (baseTypeSizes[fieldDef.GetType() & FIT_BASE_TYPE_NUM_MASK] != sizeof(FIT_UINT32)) ||
+			    (fieldDef.GetSize() != sizeof(FIT_UINT32)) || ((fieldDef.GetType() & FIT_BASE_TYPE_ENDIAN_FLAG) == 0))
+				return FIT_FALSE;
+
+			timestampOffset = offset;
+		}
+
+		offset += fieldDef.GetSize();
+	}
+
+	localTimestampOffsets[localMesgIndex] = timestampOffset;
+	localAccumulatedFields[localMesgIndex].clear();
+	localMesgSkipped[localMesgIndex] = FIT_TRUE;
+	return FIT_TRUE;
+}
+
+void Decode::UpdateRawMesg(void) {
+	const MesgDefinition &defn = localMesgDefs[localMesgIndex];
+	std::vector<RAW_FIELD> &accumulatedFields = localAccumulatedFields[localMesgIndex];
+	FIT_UINT32 offset = 0;
+
+	localTimestampOffsets[localMesgIndex] = FIT_UINT32_INVALID;
+	accumulatedFields.clear();
+
+	if ((rawMesgListener == NULL) || (defn.GetFields().size() == 0))
+		return;
+
+	// Developer data messages are needed by the decoder itself.
+	if ((defn.GetNum() == FIT_MESG_NUM_DEVELOPER_DATA_ID) || (defn.GetNum() == FIT_MESG_NUM_FIELD_DESCRIPTION))
+		return;
+
+	for (size_t i = 0; i < defn.GetFields().size(); i++) {
+		const FieldDefinition &fieldDef = defn.GetFields()[i];
+		const Profile::FIELD *field = Profile::GetField(defn.GetNum(), fieldDef.GetNum());
+
+		if (field != NULL) {
+			// Accumulated components need the decoded message.
+			for (FIT_UINT16 j = 0; j < field->numComponents; j++) {
+				if (field->components[j].accumulate)
+					return;
+			}
+
+			for (FIT_UINT16 j = 0; j < field->numSubFields; j++) {
+				for (FIT_UINT16 k = 0; k < field->subFields[j].numComponents; k++) {
+					if (field->subFields[j].components[k].accumulate)
+						return;
+				}
+			}
+
+			if ((fieldDef.GetNum() == FIT_FIELD_NUM_TIMESTAMP) || field->isAccumulated) {
+				FIT_UINT8 typeSize = baseTypeSizes[field->type & FIT_BASE_TYPE_NUM_MASK];
+
+				// Only plain values that are read with the profile type are tracked here.
+				if (((fieldDef.GetType() & FIT_BASE_TYPE_NUM_MASK) >= FIT_BASE_TYPES) ||
+				    (baseTypeSizes[fieldDef.GetType() & FIT_BASE_TYPE_NUM_MASK] != typeSize) ||
+				    (fieldDef.GetSize() != typeSize) || (typeSize > sizeof(FIT_UINT32)) ||
+				    ((typeSize > 1) && ((fieldDef.GetType() & FIT_BASE_TYPE_ENDIAN_FLAG) == 0)))
+					return;
+
+				if (fieldDef.GetNum() == FIT_FIELD_NUM_TIMESTAMP) {
+					localTimestampOffsets[localMesgIndex] = offset;
+				} else {
+					RAW_FIELD accumulatedField = {offset, field->num, typeSize, field->type};
+					accumulatedFields.push_back(accumulatedField);
+				}
+			}
+		}
+
+		offset += fieldDef.GetSize();
+	}
+
+	localMesgRaw[localMesgIndex] =
+	    rawMesgListener->OnRawMesgDefinition(defn, (archs[localMesgIndex] == FIT_ARCH_ENDIAN_BIG));
+}
+
+FIT_UINT32 Decode::ReadMesg(const FIT_UINT8 *data, FIT_UINT32 size) {
+	FIT_UINT8 header = data[0];
+	FIT_BOOL compressedTimestamp = ((header & FIT_HDR_TIME_REC_BIT) != 0);
+	FIT_UINT8 localIndex;
+
+	if (compressedTimestamp) {
+		localIndex = (header & FIT_HDR_TIME_TYPE_MASK) >> FIT_HDR_TIME_TYPE_SHIFT;
+	} else if ((header & FIT_HDR_TYPE_DEF_BIT) != 0) {
+		return 0; // Definition message.
+	} else {
+		localIndex = header & FIT_HDR_TYPE_MASK;
+	}
+
+	if (localMesgSizes[localIndex] == FIT_UINT32_INVALID)
+		return 0;
+
+	const MesgDefinition &defn = localMesgDefs[localIndex];
+
+	// A compressed timestamp message without regular fields ends after its header.
+	FIT_UINT32 mesgSize = 1;
+	if (!compressedTimestamp || (defn.GetFields().size() != 0))
+		mesgSize += localMesgSizes[localIndex];
+
+	if (mesgSize > size)
+		return 0; // Message continues in the next buffer.
+
+	if (skipHeader == FIT_FALSE) {
+		if (fileBytesLeft < (mesgSize + 2))
+			return 0; // Message overlaps the file CRC.
+
+		if (suppressCrcCheck == FIT_FALSE)
+			crc = CRC::Update16(crc, data, mesgSize);
+
+		fileBytesLeft -= mesgSize;
+	}
+
+	localMesgIndex = localIndex;
+
+	if (localMesgSkipped[localIndex]) {
+		if (compressedTimestamp) {
+			FIT_UINT8 timeOffset = header & FIT_HDR_TIME_OFFSET_MASK;
+
+			timestamp += (timeOffset - lastTimeOffset) & FIT_HDR_TIME_OFFSET_MASK;
+			lastTimeOffset = timeOffset;
+		}
+
+		if (localTimestampOffsets[localIndex] != FIT_UINT32_INVALID) {
+			timestamp = ReadRawValue(data + 1 + localTimestampOffsets[localIndex], sizeof(FIT_UINT32));
+			lastTimeOffset = (FIT_UINT8)(timestamp & FIT_HDR_TIME_OFFSET_MASK);
+		}
+
+		return mesgSize;
+	}
+
+	if (localMesgRaw[localIndex]) {
+		FIT_UINT32 timestampOffset = localTimestampOffsets[localIndex];
+
+		if (!compressedTimestamp) {
+			ReadRawMesg(data + 1, FIT_DATE_TIME_INVALID);
+			return mesgSize;
+		}
+
+		// A timestamp field would override the compressed timestamp; leave that to the Mesg path.
+		if (timestampOffset == FIT_UINT32_INVALID) {
+			FIT_UINT8 timeOffset = header & FIT_HDR_TIME_OFFSET_MASK;
+
+			timestamp += (timeOffset - lastTimeOffset) & FIT_HDR_TIME_OFFSET_MASK;
+			lastTimeOffset = timeOffset;
+			ReadRawMesg(data + 1, timestamp);
+			return mesgSize;
+		}
+	}
+
+	mesg = &localMesgs[localMesgIndex];
+	mesg->Reset(defn.GetNum());
+	mesg->SetLocalNum(localMesgIndex);
+
+	if (compressedTimestamp) {
+		Field timestampField = Field(Profile::MESG_RECORD, Profile::RECORD_MESG_TIMESTAMP);
+		FIT_UINT8 timeOffset = header & FIT_HDR_TIME_OFFSET_MASK;
+
+		timestamp += (timeOffset - lastTimeOffset) & FIT_HDR_TIME_OFFSET_MASK;
+		lastTimeOffset = timeOffset;
+		timestampField.SetUINT32Value(timestamp);
+		mesg->AddField(timestampField);
+
+		if (defn.GetFields().size() == 0) {
+			DispatchMesg();
+			return mesgSize;
+		}
+	}
+
+	const FIT_UINT8 *fieldPtr = data + 1;
+
+	if (defn.GetFields().size() != 0) {
+		for (size_t i = 0; i < defn.GetFields().size(); i++) {
+			const FieldDefinition &fieldDef = defn.GetFields()[i];
+
+			memcpy(fieldData, fieldPtr, fieldDef.GetSize());
+			fieldPtr += fieldDef.GetSize();
+			ReadFieldData(fieldDef);
+		}
+
+		ExpandMesgComponents();
+	}
+
+	for (size_t i = 0; i < defn.GetDevFields().size(); i++) {
+		const DeveloperFieldDefinition &fieldDef = defn.GetDevFields()[i];
+
+		memcpy(fieldData, fieldPtr, fieldDef.GetSize());
+		fieldPtr += fieldDef.GetSize();
+		ReadDevFieldData(fieldDef);
+	}
+
+	DispatchMesg();
+	return mesgSize;
+}
+
+void Decode::ReadRawMesg(const FIT_UINT8 *data, FIT_UINT32 mesgTimestamp) {
+	const MesgDefinition &defn = localMesgDefs[localMesgIndex];
+	const std::vector<RAW_FIELD> &accumulatedFields = localAccumulatedFields[localMesgIndex];
+
+	if (localTimestampOffsets[localMesgIndex] != FIT_UINT32_INVALID) {
+		timestamp = ReadRawValue(data + localTimestampOffsets[localMesgIndex], sizeof(FIT_UINT32));
+		mesgTimestamp = timestamp;
+		lastTimeOffset = (FIT_UINT8)(timestamp & FIT_HDR_TIME_OFFSET_MASK);
+	}
+
+	// Allows messages containing the accumulated field to set the accumulated value
+	for (size_t i = 0; i < accumulatedFields.size(); i++) {
+		const RAW_FIELD &field = accumulatedFields[i];
+
+		if (memcmp(data + field.offset, baseTypeInvalids[field.type & FIT_BASE_TYPE_NUM_MASK], field.size) != 0)
+			accumulator.Set(defn.GetNum(), field.num, ReadRawValue(data + field.offset, field.size));
+	}
+
+	rawMesgListener->OnRawMesg(defn, data, mesgTimestamp);
+}
+
+FIT_UINT32 Decode::ReadRawValue(const FIT_UINT8 *data, FIT_UINT8 size) const {
+	FIT_UINT32 value = 0;
+
+	if (archs[localMesgIndex] == FIT_ARCH_ENDIAN_BIG) {
+		for (FIT_UINT8 i = 0; i < size; i++)
+			value = (value << 8) | data[i];
+	} else {
+		for (FIT_UINT8 i = size; i > 0; i--)
+			value = (value << 8) | data[i - 1];
+	}
+
+	return value;
+}
+
+void Decode::ReadFieldData(const FieldDefinition &fieldDef) {
+	FIT_UINT8 baseType = fieldDef.GetType() & FIT_BASE_TYPE_NUM_MASK;
+	FIT_UINT8 typeSize = baseTypeSizes[baseType];
+	FIT_BOOL read = FIT_TRUE;
+
+	if (baseType >= FIT_BASE_TYPES) // Ignore field if base type not supported.
+		return;
+
+	UpdateEndianness(fieldDef.GetType(), fieldDef.GetSize());
+
+	Field field(mesg->GetNum(), fieldDef.GetNum());
+	if (!field.IsValid()) // Ignore unknown field types.
+		return;
+
+	if (field.GetType() != fieldDef.GetType()) {
+		FIT_UINT8 profileSize = fit::baseTypeSizes[(field.GetType() & FIT_BASE_TYPE_NUM_MASK)];
+		if (typeSize < profileSize) {
+			field.SetBaseType(fieldDef.GetType());
+		} else if (typeSize != profileSize) {
+			// Demotion is hard. Don't read the field if the
+			// sizes are different. Use the profile type if the
+			// signedness of the field has changed.
+			read = FIT_FALSE;
+		}
+	}
+
+	if (read) {
+		field.Read(&fieldData, fieldDef.GetSize());
+	}
+
+	// The special case time record.
+	if (fieldDef.GetNum() == FIT_FIELD_NUM_TIMESTAMP) {
+		timestamp = field.GetUINT32Value();
+		lastTimeOffset = (FIT_UINT8)(timestamp & FIT_HDR_TIME_OFFSET_MASK);
+	}
+
+	// Allows messages containing the accumulated field to set the accumulated value
+	if (field.GetIsAccumulated()) {
+		FIT_UINT8 i;
+		for (i = 0; i < field.GetNumValues(); i++) {
+			FIT_FLOAT64 value = field.GetRawValue(i);
+			FIT_UINT16 j;
+			for (j = 0; j < mesg->GetNumFields(); j++) {
+				FIT_UINT16 k;
+				Field *containingField = mesg->GetFieldByIndex(j);
+				FIT_UINT16 numComponents = containingField->GetNumComponents();
+
+				for (k = 0; k < numComponents; k++) {
+					const Profile::FIELD_COMPONENT *fc = containingField->GetComponent(k);
+					if ((fc->num == field.GetNum()) && (fc->accumulate)) {
+						value = ((((value / field.GetScale()) - field.GetOffset()) + fc->offset) * fc->scale);
+					}
+				}
+			}
+			accumulator.Set(mesg->GetNum(), field.GetNum(), (FIT_UINT32)value);
+		}
+	}
+
+	if (field.GetNumValues() > 0) {
+		mesg->AddField(field);
+	}
+}
+
+void Decode::ReadDevFieldData(const DeveloperFieldDefinition &fieldDef) {
+	FIT_UINT8 baseType = fieldDef.GetType() & FIT_BASE_TYPE_NUM_MASK;
+
+	if (baseType >= FIT_BASE_TYPES) // Ignore field if base type not supported.
+		return;
+
+	DeveloperField field(fieldDef);
+
+	UpdateEndianness(fieldDef.GetType(), fieldDef.GetSize());
+	field.Read(&fieldData, fieldDef.GetSize());
+	mesg->AddDeveloperField(field);
+}
+
+void Decode::ExpandMesgComponents(void) {
+	const std::unordered_set<FIT_UINT8> *expanded = NULL;
+
+	if (!expandedFields.empty()) {
+		std::unordered_map<FIT_UINT16, std::unordered_set<FIT_UINT8>>::const_iterator it =
+		    expandedFields.find(mesg->GetNum());
+
+		if (it != expandedFields.end()) {
+			if (it->second.empty())
+				return;
+			expanded = &it->second;
+		}
+	}
+
+	// Now that the entire message is decoded we may evaluate subfields and expand components
+	for (FIT_UINT16 i = 0; i < mesg->GetNumFields(); i++) {
+		FIT_UINT16 activeSubField = mesg->GetActiveSubFieldIndexByFieldIndex(i);
+		if (!suppressComponentExpansion) {
+			if (activeSubField == FIT_SUBFIELD_INDEX_MAIN_FIELD) {
+				if (mesg->GetFieldByIndex(i)->GetNumComponents() > 0) {
+					ExpandComponents(i, mesg->GetFieldByIndex(i)->GetComponent(0),
+					                 mesg->GetFieldByIndex(i)->GetNumComponents(), expanded);
+				}
+			} else {
+				if (mesg->GetFieldByIndex(i)->GetSubField(activeSubField)->numComponents > 0) {
+					ExpandComponents(i, mesg->GetFieldByIndex(i)->GetSubField(activeSubField)->components,
+					                 mesg->GetFieldByIndex(i)->GetSubField(activeSubField)->numComponents, expanded);
+				}
+			}
+		}
+	}
+}
+
+void Decode::DispatchMesg(void) {
+	if (mesg->GetNum() == FIT_MESG_NUM_DEVELOPER_DATA_ID) {
+		DeveloperDataIdMesg devIdMesg(*mesg);
+
+		if (!devIdMesg.IsDeveloperDataIndexValid()) {
+			throw fit::RuntimeException("Invalid developer data index in DeveloperDataIdMesg");
+		}
+
+		FIT_UINT8 index = devIdMesg.GetDeveloperDataIndex();
+		developers[index] = devIdMesg;
+		descriptions[index] = std::unordered_map<FIT_UINT8, FieldDescriptionMesg>();
+	} else if (mesg->GetNum() == FIT_MESG_NUM_FIELD_DESCRIPTION) {
+		FieldDescriptionMesg descMesg(*mesg);
+
+		if (!descMesg.IsDeveloperDataIndexValid()) {
+			throw fit::RuntimeException("Invalid developer data index in FieldDescriptionMesg");
+		}
+
+		if (!descMesg.IsFieldDefinitionNumberValid()) {
+			throw fit::RuntimeException("Invalid developer field definition number in FieldDescriptionMesg");
+		}
+
+		FIT_UINT8 index = descMesg.GetDeveloperDataIndex();
+		FIT_UINT8 fldNum = descMesg.GetFieldDefinitionNumber();
+
+		try {
+			descriptions.at(index)[fldNum] = descMesg;
+
+			if (descriptionListener) {
+				descriptionListener->OnDeveloperFieldDescription(
+				    DeveloperFieldDescription(descMesg, developers[index]));
+			}
+		} catch (std::out_of_range) {
+			// Description without a Developer Data Id Message
+		}
+	}
+
+	if (mesgListener)
+		mesgListener->OnMesg(*mesg);
+}
+
 void Decode::SuppressComponentExpansion(void) {
 	suppressComponentExpansion = FIT_TRUE;
 }
 
-void Decode::ExpandComponents(Field *containingField, const Profile::FIELD_COMPONENT *components,
-                              FIT_UINT16 numComponents) {
+void Decode::SetRawMesgListener(RawMesgListener *listener) {
+	// Do not allow changing the settings after Read has started.
+	if ((file != NULL) || (source != NULL)) {
+		throw RuntimeException("Can't set raw message listener after Decode started!");
+	}
+	rawMesgListener = listener;
+}
+
+void Decode::SetWantedMesgNums(const std::unordered_set<FIT_UINT16> &mesgNums) {
+	// Do not allow changing the settings after Read has started.
+	if ((file != NULL) || (source != NULL)) {
+		throw RuntimeException("Can't set wanted messages after Decode started!");
+	}
+	wantedMesgNums = mesgNums;
+}
+
+void Decode::SetInterruptFlag(const std::atomic<bool> *flag) {
+	interrupt = flag;
+}
+
+void Decode::SetExpandedFields(FIT_UINT16 mesgNum, const std::unordered_set<FIT_UINT8> &fieldNums) {
+	expandedFields[mesgNum] = fieldNums;
+}
+
+void Decode::SuppressCrcCheck(void) {
+	// Do not allow changing the settings after Read has started.
+	if ((file != NULL) || (source != NULL)) {
+		throw RuntimeException("Can't set suppressCrcCheck option after Decode started!");
+	}
+	suppressCrcCheck = FIT_TRUE;
+}
+
+void Decode::ExpandComponents(FIT_UINT16 containingIndex, const Profile::FIELD_COMPONENT *components,
+                              FIT_UINT16 numComponents, const std::unordered_set<FIT_UINT8> *expanded) {
 	FIT_UINT16 offset = 0;
 	FIT_UINT16 i;
 
 	for (i = 0; i < numComponents; i++) {
 		const Profile::FIELD_COMPONENT *component = &components[i];
+		// Adding an expanded field may move the fields of the message, look the containing field up again
+		const Field *containingField = mesg->GetFieldByIndex(containingIndex);
 
-		if (component->num != FIT_FIELD_NUM_INVALID) {
-			Field componentField(mesg.GetNum(), component->num);
-			FIT_UINT16 subfieldIndex = mesg.GetActiveSubFieldIndex(componentField.GetNum());
+		if ((expanded != NULL) && (expanded->count(component->num) == 0)) {
+			// Not expanded, but the components that follow still end where this one runs out of data.
+			if ((component->num != FIT_FIELD_NUM_INVALID) &&
+			    (containingField->GetBitsValue(offset, component->bits) == FIT_UINT32_INVALID))
+				break;
+		} else if (component->num != FIT_FIELD_NUM_INVALID) {
+			Field componentField(mesg->GetNum(), component->num);
+			FIT_UINT16 subfieldIndex = mesg->GetActiveSubFieldIndex(componentField.GetNum());
 			FIT_FLOAT64 value;
 			FIT_UINT32 bitsValue = FIT_UINT32_INVALID;
 			FIT_SINT32 signedBitsValue = FIT_SINT32_INVALID;
@@ -854,7 +1342,7 @@ void Decode::ExpandComponents(Field *containingField, const Profile::FIELD_COMPO
 					break; // No more data for components.
 
 				if (component->accumulate)
-					bitsValue = accumulator.Accumulate(mesg.GetNum(), component->num, signedBitsValue, component->bits);
+					bitsValue = accumulator.Accumulate(mesg->GetNum(), component->num, signedBitsValue, component->bits);
 			} else {
 				bitsValue = containingField->GetBitsValue(offset, component->bits);
 
@@ -862,7 +1350,7 @@ void Decode::ExpandComponents(Field *containingField, const Profile::FIELD_COMPO
 					break; // No more data for components.
 
 				if (component->accumulate)
-					bitsValue = accumulator.Accumulate(mesg.GetNum(), component->num, bitsValue, component->bits);
+					bitsValue = accumulator.Accumulate(mesg->GetNum(), component->num, bitsValue, component->bits);
 			}
 
 			// If the component field itself has *one* component apply the scale and offset of the componentField's
@@ -876,12 +1364,12 @@ void Decode::ExpandComponents(Field *containingField, const Profile::FIELD_COMPO
 					value = (((bitsValue / (FIT_FLOAT64)component->scale) - component->offset) +
 					         componentField.GetComponent(0)->offset) *
 					        componentField.GetComponent(0)->scale;
-				if (mesg.HasField(componentField.GetNum())) {
-					fit::Field *currentField = mesg.GetField(componentField.GetNum());
+				if (mesg->HasField(componentField.GetNum())) {
+					fit::Field *currentField = mesg->GetField(componentField.GetNum());
 					currentField->AddRawValue(value, currentField->GetNumValues());
 				} else {
 					componentField.AddRawValue(value, componentField.GetNumValues());
-					mesg.AddField(componentField);
+					mesg->AddField(componentField);
 				}
 			}
 			// The component field is itself a composite field (more than one component).  Don't use scale/offset,
@@ -892,12 +1380,12 @@ void Decode::ExpandComponents(Field *containingField, const Profile::FIELD_COMPO
 
 				while (bitsAdded < component->bits) {
 					mask = ((long)1 << baseTypeSizes[componentField.GetType() & FIT_BASE_TYPE_NUM_MASK]) - 1;
-					if (mesg.HasField(componentField.GetNum())) {
-						Field *field = mesg.GetField(componentField.GetNum());
+					if (mesg->HasField(componentField.GetNum())) {
+						Field *field = mesg->GetField(componentField.GetNum());
 						field->AddValue(bitsValue & mask, field->GetNumValues());
 					} else {
 						componentField.AddValue(bitsValue & mask, componentField.GetNumValues());
-						mesg.AddField(componentField);
+						mesg->AddField(componentField);
 					}
 					bitsValue >>= baseTypeSizes[componentField.GetType() & FIT_BASE_TYPE_NUM_MASK];
 					bitsAdded += baseTypeSizes[componentField.GetType() & FIT_BASE_TYPE_NUM_MASK];
@@ -913,12 +1401,12 @@ void Decode::ExpandComponents(Field *containingField, const Profile::FIELD_COMPO
 					value = (((bitsValue / (FIT_FLOAT64)component->scale) - component->offset) +
 					         componentField.GetOffset(subfieldIndex)) *
 					        componentField.GetScale(subfieldIndex);
-				if (mesg.HasField(componentField.GetNum())) {
-					fit::Field *currentField = mesg.GetField(componentField.GetNum());
+				if (mesg->HasField(componentField.GetNum())) {
+					fit::Field *currentField = mesg->GetField(componentField.GetNum());
 					currentField->AddRawValue(value, currentField->GetNumValues());
 				} else {
 					componentField.AddRawValue(value, componentField.GetNumValues());
-					mesg.AddField(componentField);
+					mesg->AddField(componentField);
 				}
 			}
 		}
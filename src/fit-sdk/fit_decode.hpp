@@ -12,9 +12,12 @@
 #if !defined(FIT_DECODE_HPP)
 #define FIT_DECODE_HPP
 
+#include <atomic>
 #include <iosfwd>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "fit.hpp"
 #include "fit_accumulator.hpp"
 #include "fit_field.hpp"
@@ -23,6 +26,7 @@
 #include "fit_mesg_definition_listener.hpp"
 #include "fit_developer_field_description_listener.hpp"
 #include "fit_mesg_listener.hpp"
+#include "fit_raw_mesg_listener.hpp"
 #include "fit_runtime_exception.hpp"
 #include "fit_developer_data_id_mesg.hpp"
 
@@ -48,6 +52,15 @@ public:
 	// Returns true if file is ok (not corrupt).
 	///////////////////////////////////////////////////////////////////////
 
+	FIT_BOOL CheckIntegrity(const void *data, FIT_UINT32 size);
+	///////////////////////////////////////////////////////////////////////
+	// Checks compatibility and integrity of a FIT binary file held in memory.
+	// Parameters:
+	//    data     Pointer to the file contents.
+	//    size     Size of the file contents in bytes.
+	// Returns true if file is ok (not corrupt).
+	///////////////////////////////////////////////////////////////////////
+
 	void SkipHeader();
 	///////////////////////////////////////////////////////////////////////
 	// Overrides the default read behaviour by skipping header decode.
@@ -71,6 +84,56 @@ public:
 	// up processing significantly.
 	///////////////////////////////////////////////////////////////////////
 
+	void SetExpandedFields(FIT_UINT16 mesgNum, const std::unordered_set<FIT_UINT8> &fieldNums);
+	///////////////////////////////////////////////////////////////////////
+	// Restricts the component expansion of messages with the given global
+	// message number to the components whose destination field is one of
+	// fieldNums. An empty set expands none of them. Messages of other
+	// numbers keep expanding every component. Accumulated components that
+	// are not expanded are not accumulated either.
+	// Parameters:
+	//    mesgNum                 Global message number.
+	//    fieldNums               Destination field numbers to expand.
+	///////////////////////////////////////////////////////////////////////
+
+	void SuppressCrcCheck(void);
+	///////////////////////////////////////////////////////////////////////
+	// Override the default read behaviour by not computing or verifying the
+	// file CRC while decoding. Use when the CRC has already been verified over
+	// the whole file (see CRC::Update16) or is not wanted. May only be called
+	// prior to calling Read.
+	///////////////////////////////////////////////////////////////////////
+
+	void SetInterruptFlag(const std::atomic<bool> *flag);
+	///////////////////////////////////////////////////////////////////////
+	// Stops decoding once the flag is set, as if paused: Read and Resume
+	// return false. The flag is polled between buffers and every
+	// InterruptCheckInterval bytes. Pass NULL to disable.
+	///////////////////////////////////////////////////////////////////////
+
+	void SetRawMesgListener(RawMesgListener *listener);
+	///////////////////////////////////////////////////////////////////////
+	// Offers every decoded definition message to the listener. Data messages
+	// of claimed definitions are passed to the listener undecoded when they
+	// are read from a whole buffer, otherwise they are broadcast as Mesg.
+	// Timestamps and accumulated fields are still tracked by the decoder.
+	// Definitions with accumulated components and developer data messages
+	// are never offered. May only be called prior to calling Read.
+	// Parameters:
+	//    listener                Raw message listener, or NULL to disable.
+	///////////////////////////////////////////////////////////////////////
+
+	void SetWantedMesgNums(const std::unordered_set<FIT_UINT16> &mesgNums);
+	///////////////////////////////////////////////////////////////////////
+	// Restricts decoding to the given global message numbers. Data messages
+	// of any other definition are skipped by their size without reading
+	// their fields, only their timestamp is tracked for compressed
+	// timestamps. Developer data messages are always decoded. An empty set
+	// decodes every message. May only be called prior to calling Read.
+	// Parameters:
+	//    mesgNums                Global message numbers to decode.
+	///////////////////////////////////////////////////////////////////////
+
 	FIT_BOOL Read(std::istream &file, MesgListener &mesgListener);
 	///////////////////////////////////////////////////////////////////////
 	// Reads a FIT binary file.
@@ -102,6 +165,22 @@ public:
 	// Returns true if finished read file, otherwise false if decoding is paused.
 	///////////////////////////////////////////////////////////////////////
 
+	FIT_BOOL Read(const void *data, FIT_UINT32 size, MesgListener *mesgListener,
+	              MesgDefinitionListener *definitionListener, DeveloperFieldDescriptionListener *descriptionListener);
+	///////////////////////////////////////////////////////////////////////
+	// Reads a FIT binary file held in a contiguous memory buffer (e.g. a
+	// memory mapped file). The whole buffer is decoded in place without
+	// going through a stream. The buffer must stay valid until decoding
+	// is finished, including any calls to Resume().
+	// Parameters:
+	//    data                    Pointer to the file contents.
+	//    size                    Size of the file contents in bytes.
+	//    mesgListener            Message listener
+	//    definitionListener      Message definition listener
+	//    descriptionListener     Developer field description listener
+	// Returns true if finished read file, otherwise false if decoding is paused.
+	///////////////////////////////////////////////////////////////////////
+
 	void Pause(void);
 	///////////////////////////////////////////////////////////////////////
 	// Pauses the decoding of a FIT binary file.  Call Resume() to resume decoding.
@@ -109,7 +188,8 @@ public:
 
 	FIT_BOOL Resume(void);
 	///////////////////////////////////////////////////////////////////////
-	// Resumes the decoding of a FIT binary file (see Pause()).
+	// Resumes the decoding of a FIT binary file (see Pause()). The chained
+	// files of a memory buffer are decoded up to the end of the buffer.
 	// Returns true if finished reading file.
 	///////////////////////////////////////////////////////////////////////
 
@@ -150,10 +230,18 @@ private:
 
 	typedef enum { RETURN_CONTINUE, RETURN_MESG, RETURN_MESG_DEF, RETURN_END_OF_FILE, RETURN_ERROR, RETURNS } RETURN;
 
+	typedef struct {
+		FIT_UINT32 offset;
+		FIT_UINT8 num;
+		FIT_UINT8 size;
+		FIT_UINT8 type;
+	} RAW_FIELD;
+
 	static const FIT_UINT8 DevFieldNumOffset;
 	static const FIT_UINT8 DevFieldSizeOffset;
 	static const FIT_UINT8 DevFieldIndexOffset;
 	static const FIT_UINT16 BufferSize = 512;
+	static const FIT_UINT32 InterruptCheckInterval = 65536;
 
 	STATE state;
 	FIT_BOOL hasDevData;
@@ -162,10 +250,16 @@ private:
 	FIT_UINT32 fileDataSize;
 	FIT_UINT32 fileBytesLeft;
 	FIT_UINT16 crc;
-	Mesg mesg;
+	Mesg *mesg;
 	FIT_UINT8 localMesgIndex;
 	MesgDefinition localMesgDefs[FIT_MAX_LOCAL_MESGS];
+	Mesg localMesgs[FIT_MAX_LOCAL_MESGS]; // Reused for every message of a local slot to keep field storage.
 	FIT_UINT8 archs[FIT_MAX_LOCAL_MESGS];
+	FIT_UINT32 localMesgSizes[FIT_MAX_LOCAL_MESGS];
+	FIT_BOOL localMesgRaw[FIT_MAX_LOCAL_MESGS];
+	FIT_BOOL localMesgSkipped[FIT_MAX_LOCAL_MESGS];
+	FIT_UINT32 localTimestampOffsets[FIT_MAX_LOCAL_MESGS];
+	std::vector<RAW_FIELD> localAccumulatedFields[FIT_MAX_LOCAL_MESGS];
 	FIT_UINT8 numFields;
 	FIT_UINT8 fieldIndex;
 	FIT_UINT8 fieldDataIndex;
@@ -175,27 +269,52 @@ private:
 	FIT_UINT32 timestamp;
 	Accumulator accumulator;
 	std::istream *file;
+	const FIT_UINT8 *source;
+	FIT_UINT32 sourceSize;
+	FIT_UINT32 sourceOffset;
 	MesgListener *mesgListener;
 	MesgDefinitionListener *mesgDefinitionListener;
 	DeveloperFieldDescriptionListener *descriptionListener;
+	RawMesgListener *rawMesgListener;
+	std::unordered_set<FIT_UINT16> wantedMesgNums;
+	std::unordered_map<FIT_UINT16, std::unordered_set<FIT_UINT8>> expandedFields;
 	FIT_BOOL pause;
+	const std::atomic<bool> *interrupt;
+	FIT_UINT32 nextInterruptCheck;
 	std::string headerException;
 	FIT_BOOL skipHeader;
 	FIT_BOOL streamIsComplete;
 	FIT_BOOL invalidDataSize;
 	FIT_BOOL suppressComponentExpansion;
+	FIT_BOOL suppressCrcCheck;
 	FIT_UINT32 currentByteOffset;
 	std::unordered_map<FIT_UINT8, DeveloperDataIdMesg> developers;
 	std::unordered_map<FIT_UINT8, std::unordered_map<FIT_UINT8, FieldDescriptionMesg>> descriptions;
 	FIT_UINT32 currentByteIndex;
 	FIT_UINT32 bytesRead;
 	char buffer[BufferSize];
+	const FIT_UINT8 *readBuffer;
 
+	void InitRead(void);
 	void InitRead(std::istream &file);
 	void InitRead(std::istream &file, FIT_BOOL startOfFile);
+	FIT_BOOL ResumeFile(void);
+	void FillBuffer(void);
+	FIT_BOOL MoreData(void) const;
 	void UpdateEndianness(FIT_UINT8 type, FIT_UINT8 size);
+	void UpdateMesgSize(void);
+	void UpdateRawMesg(void);
+	FIT_BOOL UpdateSkippedMesg(void);
 	RETURN ReadByte(FIT_UINT8 data);
-	void ExpandComponents(Field *containingField, const Profile::FIELD_COMPONENT *components, FIT_UINT16 numComponents);
+	FIT_UINT32 ReadMesg(const FIT_UINT8 *data, FIT_UINT32 size);
+	void ReadRawMesg(const FIT_UINT8 *data, FIT_UINT32 mesgTimestamp);
+	FIT_UINT32 ReadRawValue(const FIT_UINT8 *data, FIT_UINT8 size) const;
+	void ReadFieldData(const FieldDefinition &fieldDef);
+	void ReadDevFieldData(const DeveloperFieldDefinition &fieldDef);
+	void ExpandMesgComponents(void);
+	void DispatchMesg(void);
+	void ExpandComponents(FIT_UINT16 containingIndex, const Profile::FIELD_COMPONENT *components,
+	                      FIT_UINT16 numComponents, const std::unordered_set<FIT_UINT8> *expanded);
 	FIT_BOOL Read(std::istream *file);
 };
 
@@ -18,6 +18,7 @@
 #include <vector>
 #include "fit.hpp"
 #include "fit_profile.hpp"
+#include "fit_small_vector.hpp"
 
 namespace fit {
 
@@ -121,7 +122,8 @@ private:
 	FIT_FLOAT64 GetRawValueInternal(const FIT_UINT8 fieldArrayIndex = 0) const;
 	static FIT_FLOAT64 Round(FIT_FLOAT64 value);
 
-	std::vector<FIT_BYTE> values;
+	// Most fields hold a few bytes, which fit in place without a heap allocation.
+	SmallVector<FIT_BYTE, 16> values;
 	std::vector<FIT_UINT8> stringIndexes;
 };
 
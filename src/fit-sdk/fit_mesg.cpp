@@ -32,6 +32,21 @@ Mesg::Mesg(const std::string &name) : profile(Profile::GetMesg(name)), localNum(
 Mesg::Mesg(const FIT_UINT16 num) : profile(Profile::GetMesg(num)), localNum(0), fields(), devFields() {
 }
 
+void Mesg::Reset(const FIT_UINT16 num) {
+	// Keeps the capacity of the field vectors so a reused message does not allocate.
+	profile = Profile::GetMesg(num);
+	localNum = 0;
+	fields.clear();
+	devFields.clear();
+}
+
+void Mesg::Swap(Mesg &mesg) {
+	std::swap(profile, mesg.profile);
+	std::swap(localNum, mesg.localNum);
+	fields.swap(mesg.fields);
+	devFields.swap(mesg.devFields);
+}
+
 FIT_BOOL Mesg::IsValid(void) const {
 	return (profile != FIT_NULL);
 }
@@ -30,6 +30,8 @@ public:
 	Mesg(const Profile::MESG_INDEX index);
 	Mesg(const std::string &name);
 	Mesg(const FIT_UINT16 num);
+	void Reset(const FIT_UINT16 num);
+	void Swap(Mesg &mesg);
 	FIT_BOOL IsValid(void) const;
 	FIT_BOOL GetIsFieldAccumulated(const FIT_UINT8 num) const;
 	const DeveloperField *GetDeveloperField(FIT_UINT8 developerDataIndex, FIT_UINT8 num) const;
@@ -1419,738 +1419,982 @@ void MesgBroadcaster::OnMesg(Mesg &mesg) {
 	for (int i = 0; i < (int)mesgListeners.size(); i++)
 		mesgListeners[i]->OnMesg(mesg);
 
+	// The typed message borrows the fields of mesg for the listeners and hands them back, so
+	// broadcasting a message copies no field storage.
 	switch (mesg.GetNum()) {
 	case FIT_MESG_NUM_FILE_ID: {
-		FileIdMesg fileIdMesg(mesg);
+		FileIdMesg fileIdMesg;
+		fileIdMesg.Swap(mesg);
 		for (int i = 0; i < (int)fileIdMesgListeners.size(); i++)
 			fileIdMesgListeners[i]->OnMesg(fileIdMesg);
+		fileIdMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_FILE_CREATOR: {
-		FileCreatorMesg fileCreatorMesg(mesg);
+		FileCreatorMesg fileCreatorMesg;
+		fileCreatorMesg.Swap(mesg);
 		for (int i = 0; i < (int)fileCreatorMesgListeners.size(); i++)
 			fileCreatorMesgListeners[i]->OnMesg(fileCreatorMesg);
+		fileCreatorMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_TIMESTAMP_CORRELATION: {
-		TimestampCorrelationMesg timestampCorrelationMesg(mesg);
+		TimestampCorrelationMesg timestampCorrelationMesg;
+		timestampCorrelationMesg.Swap(mesg);
 		for (int i = 0; i < (int)timestampCorrelationMesgListeners.size(); i++)
 			timestampCorrelationMesgListeners[i]->OnMesg(timestampCorrelationMesg);
+		timestampCorrelationMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SOFTWARE: {
-		SoftwareMesg softwareMesg(mesg);
+		SoftwareMesg softwareMesg;
+		softwareMesg.Swap(mesg);
 		for (int i = 0; i < (int)softwareMesgListeners.size(); i++)
 			softwareMesgListeners[i]->OnMesg(softwareMesg);
+		softwareMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SLAVE_DEVICE: {
-		SlaveDeviceMesg slaveDeviceMesg(mesg);
+		SlaveDeviceMesg slaveDeviceMesg;
+		slaveDeviceMesg.Swap(mesg);
 		for (int i = 0; i < (int)slaveDeviceMesgListeners.size(); i++)
 			slaveDeviceMesgListeners[i]->OnMesg(slaveDeviceMesg);
+		slaveDeviceMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_CAPABILITIES: {
-		CapabilitiesMesg capabilitiesMesg(mesg);
+		CapabilitiesMesg capabilitiesMesg;
+		capabilitiesMesg.Swap(mesg);
 		for (int i = 0; i < (int)capabilitiesMesgListeners.size(); i++)
 			capabilitiesMesgListeners[i]->OnMesg(capabilitiesMesg);
+		capabilitiesMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_FILE_CAPABILITIES: {
-		FileCapabilitiesMesg fileCapabilitiesMesg(mesg);
+		FileCapabilitiesMesg fileCapabilitiesMesg;
+		fileCapabilitiesMesg.Swap(mesg);
 		for (int i = 0; i < (int)fileCapabilitiesMesgListeners.size(); i++)
 			fileCapabilitiesMesgListeners[i]->OnMesg(fileCapabilitiesMesg);
+		fileCapabilitiesMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_MESG_CAPABILITIES: {
-		MesgCapabilitiesMesg mesgCapabilitiesMesg(mesg);
+		MesgCapabilitiesMesg mesgCapabilitiesMesg;
+		mesgCapabilitiesMesg.Swap(mesg);
 		for (int i = 0; i < (int)mesgCapabilitiesMesgListeners.size(); i++)
 			mesgCapabilitiesMesgListeners[i]->OnMesg(mesgCapabilitiesMesg);
+		mesgCapabilitiesMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_FIELD_CAPABILITIES: {
-		FieldCapabilitiesMesg fieldCapabilitiesMesg(mesg);
+		FieldCapabilitiesMesg fieldCapabilitiesMesg;
+		fieldCapabilitiesMesg.Swap(mesg);
 		for (int i = 0; i < (int)fieldCapabilitiesMesgListeners.size(); i++)
 			fieldCapabilitiesMesgListeners[i]->OnMesg(fieldCapabilitiesMesg);
+		fieldCapabilitiesMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DEVICE_SETTINGS: {
-		DeviceSettingsMesg deviceSettingsMesg(mesg);
+		DeviceSettingsMesg deviceSettingsMesg;
+		deviceSettingsMesg.Swap(mesg);
 		for (int i = 0; i < (int)deviceSettingsMesgListeners.size(); i++)
 			deviceSettingsMesgListeners[i]->OnMesg(deviceSettingsMesg);
+		deviceSettingsMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_USER_PROFILE: {
-		UserProfileMesg userProfileMesg(mesg);
+		UserProfileMesg userProfileMesg;
+		userProfileMesg.Swap(mesg);
 		for (int i = 0; i < (int)userProfileMesgListeners.size(); i++)
 			userProfileMesgListeners[i]->OnMesg(userProfileMesg);
+		userProfileMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HRM_PROFILE: {
-		HrmProfileMesg hrmProfileMesg(mesg);
+		HrmProfileMesg hrmProfileMesg;
+		hrmProfileMesg.Swap(mesg);
 		for (int i = 0; i < (int)hrmProfileMesgListeners.size(); i++)
 			hrmProfileMesgListeners[i]->OnMesg(hrmProfileMesg);
+		hrmProfileMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SDM_PROFILE: {
-		SdmProfileMesg sdmProfileMesg(mesg);
+		SdmProfileMesg sdmProfileMesg;
+		sdmProfileMesg.Swap(mesg);
 		for (int i = 0; i < (int)sdmProfileMesgListeners.size(); i++)
 			sdmProfileMesgListeners[i]->OnMesg(sdmProfileMesg);
+		sdmProfileMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_BIKE_PROFILE: {
-		BikeProfileMesg bikeProfileMesg(mesg);
+		BikeProfileMesg bikeProfileMesg;
+		bikeProfileMesg.Swap(mesg);
 		for (int i = 0; i < (int)bikeProfileMesgListeners.size(); i++)
 			bikeProfileMesgListeners[i]->OnMesg(bikeProfileMesg);
+		bikeProfileMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_CONNECTIVITY: {
-		ConnectivityMesg connectivityMesg(mesg);
+		ConnectivityMesg connectivityMesg;
+		connectivityMesg.Swap(mesg);
 		for (int i = 0; i < (int)connectivityMesgListeners.size(); i++)
 			connectivityMesgListeners[i]->OnMesg(connectivityMesg);
+		connectivityMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_WATCHFACE_SETTINGS: {
-		WatchfaceSettingsMesg watchfaceSettingsMesg(mesg);
+		WatchfaceSettingsMesg watchfaceSettingsMesg;
+		watchfaceSettingsMesg.Swap(mesg);
 		for (int i = 0; i < (int)watchfaceSettingsMesgListeners.size(); i++)
 			watchfaceSettingsMesgListeners[i]->OnMesg(watchfaceSettingsMesg);
+		watchfaceSettingsMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_OHR_SETTINGS: {
-		OhrSettingsMesg ohrSettingsMesg(mesg);
+		OhrSettingsMesg ohrSettingsMesg;
+		ohrSettingsMesg.Swap(mesg);
 		for (int i = 0; i < (int)ohrSettingsMesgListeners.size(); i++)
 			ohrSettingsMesgListeners[i]->OnMesg(ohrSettingsMesg);
+		ohrSettingsMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_TIME_IN_ZONE: {
-		TimeInZoneMesg timeInZoneMesg(mesg);
+		TimeInZoneMesg timeInZoneMesg;
+		timeInZoneMesg.Swap(mesg);
 		for (int i = 0; i < (int)timeInZoneMesgListeners.size(); i++)
 			timeInZoneMesgListeners[i]->OnMesg(timeInZoneMesg);
+		timeInZoneMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_ZONES_TARGET: {
-		ZonesTargetMesg zonesTargetMesg(mesg);
+		ZonesTargetMesg zonesTargetMesg;
+		zonesTargetMesg.Swap(mesg);
 		for (int i = 0; i < (int)zonesTargetMesgListeners.size(); i++)
 			zonesTargetMesgListeners[i]->OnMesg(zonesTargetMesg);
+		zonesTargetMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SPORT: {
-		SportMesg sportMesg(mesg);
+		SportMesg sportMesg;
+		sportMesg.Swap(mesg);
 		for (int i = 0; i < (int)sportMesgListeners.size(); i++)
 			sportMesgListeners[i]->OnMesg(sportMesg);
+		sportMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HR_ZONE: {
-		HrZoneMesg hrZoneMesg(mesg);
+		HrZoneMesg hrZoneMesg;
+		hrZoneMesg.Swap(mesg);
 		for (int i = 0; i < (int)hrZoneMesgListeners.size(); i++)
 			hrZoneMesgListeners[i]->OnMesg(hrZoneMesg);
+		hrZoneMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SPEED_ZONE: {
-		SpeedZoneMesg speedZoneMesg(mesg);
+		SpeedZoneMesg speedZoneMesg;
+		speedZoneMesg.Swap(mesg);
 		for (int i = 0; i < (int)speedZoneMesgListeners.size(); i++)
 			speedZoneMesgListeners[i]->OnMesg(speedZoneMesg);
+		speedZoneMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_CADENCE_ZONE: {
-		CadenceZoneMesg cadenceZoneMesg(mesg);
+		CadenceZoneMesg cadenceZoneMesg;
+		cadenceZoneMesg.Swap(mesg);
 		for (int i = 0; i < (int)cadenceZoneMesgListeners.size(); i++)
 			cadenceZoneMesgListeners[i]->OnMesg(cadenceZoneMesg);
+		cadenceZoneMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_POWER_ZONE: {
-		PowerZoneMesg powerZoneMesg(mesg);
+		PowerZoneMesg powerZoneMesg;
+		powerZoneMesg.Swap(mesg);
 		for (int i = 0; i < (int)powerZoneMesgListeners.size(); i++)
 			powerZoneMesgListeners[i]->OnMesg(powerZoneMesg);
+		powerZoneMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_MET_ZONE: {
-		MetZoneMesg metZoneMesg(mesg);
+		MetZoneMesg metZoneMesg;
+		metZoneMesg.Swap(mesg);
 		for (int i = 0; i < (int)metZoneMesgListeners.size(); i++)
 			metZoneMesgListeners[i]->OnMesg(metZoneMesg);
+		metZoneMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_TRAINING_SETTINGS: {
-		TrainingSettingsMesg trainingSettingsMesg(mesg);
+		TrainingSettingsMesg trainingSettingsMesg;
+		trainingSettingsMesg.Swap(mesg);
 		for (int i = 0; i < (int)trainingSettingsMesgListeners.size(); i++)
 			trainingSettingsMesgListeners[i]->OnMesg(trainingSettingsMesg);
+		trainingSettingsMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DIVE_SETTINGS: {
-		DiveSettingsMesg diveSettingsMesg(mesg);
+		DiveSettingsMesg diveSettingsMesg;
+		diveSettingsMesg.Swap(mesg);
 		for (int i = 0; i < (int)diveSettingsMesgListeners.size(); i++)
 			diveSettingsMesgListeners[i]->OnMesg(diveSettingsMesg);
+		diveSettingsMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DIVE_ALARM: {
-		DiveAlarmMesg diveAlarmMesg(mesg);
+		DiveAlarmMesg diveAlarmMesg;
+		diveAlarmMesg.Swap(mesg);
 		for (int i = 0; i < (int)diveAlarmMesgListeners.size(); i++)
 			diveAlarmMesgListeners[i]->OnMesg(diveAlarmMesg);
+		diveAlarmMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DIVE_APNEA_ALARM: {
-		DiveApneaAlarmMesg diveApneaAlarmMesg(mesg);
+		DiveApneaAlarmMesg diveApneaAlarmMesg;
+		diveApneaAlarmMesg.Swap(mesg);
 		for (int i = 0; i < (int)diveApneaAlarmMesgListeners.size(); i++)
 			diveApneaAlarmMesgListeners[i]->OnMesg(diveApneaAlarmMesg);
+		diveApneaAlarmMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DIVE_GAS: {
-		DiveGasMesg diveGasMesg(mesg);
+		DiveGasMesg diveGasMesg;
+		diveGasMesg.Swap(mesg);
 		for (int i = 0; i < (int)diveGasMesgListeners.size(); i++)
 			diveGasMesgListeners[i]->OnMesg(diveGasMesg);
+		diveGasMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_GOAL: {
-		GoalMesg goalMesg(mesg);
+		GoalMesg goalMesg;
+		goalMesg.Swap(mesg);
 		for (int i = 0; i < (int)goalMesgListeners.size(); i++)
 			goalMesgListeners[i]->OnMesg(goalMesg);
+		goalMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_ACTIVITY: {
-		ActivityMesg activityMesg(mesg);
+		ActivityMesg activityMesg;
+		activityMesg.Swap(mesg);
 		for (int i = 0; i < (int)activityMesgListeners.size(); i++)
 			activityMesgListeners[i]->OnMesg(activityMesg);
 		mesgWithEventBroadcaster.OnMesg(activityMesg);
+		activityMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SESSION: {
-		SessionMesg sessionMesg(mesg);
+		SessionMesg sessionMesg;
+		sessionMesg.Swap(mesg);
 		for (int i = 0; i < (int)sessionMesgListeners.size(); i++)
 			sessionMesgListeners[i]->OnMesg(sessionMesg);
 		mesgWithEventBroadcaster.OnMesg(sessionMesg);
+		sessionMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_LAP: {
-		LapMesg lapMesg(mesg);
+		LapMesg lapMesg;
+		lapMesg.Swap(mesg);
 		for (int i = 0; i < (int)lapMesgListeners.size(); i++)
 			lapMesgListeners[i]->OnMesg(lapMesg);
 		mesgWithEventBroadcaster.OnMesg(lapMesg);
+		lapMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_LENGTH: {
-		LengthMesg lengthMesg(mesg);
+		LengthMesg lengthMesg;
+		lengthMesg.Swap(mesg);
 		for (int i = 0; i < (int)lengthMesgListeners.size(); i++)
 			lengthMesgListeners[i]->OnMesg(lengthMesg);
 		mesgWithEventBroadcaster.OnMesg(lengthMesg);
+		lengthMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_RECORD: {
-		RecordMesg recordMesg(mesg);
+		RecordMesg recordMesg;
+		recordMesg.Swap(mesg);
 		for (int i = 0; i < (int)recordMesgListeners.size(); i++)
 			recordMesgListeners[i]->OnMesg(recordMesg);
 		bufferedRecordMesgBroadcaster.OnMesg(recordMesg);
+		recordMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_EVENT: {
-		EventMesg eventMesg(mesg);
+		EventMesg eventMesg;
+		eventMesg.Swap(mesg);
 		for (int i = 0; i < (int)eventMesgListeners.size(); i++)
 			eventMesgListeners[i]->OnMesg(eventMesg);
 		mesgWithEventBroadcaster.OnMesg(eventMesg);
+		eventMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DEVICE_INFO: {
-		DeviceInfoMesg deviceInfoMesg(mesg);
+		DeviceInfoMesg deviceInfoMesg;
+		deviceInfoMesg.Swap(mesg);
 		for (int i = 0; i < (int)deviceInfoMesgListeners.size(); i++)
 			deviceInfoMesgListeners[i]->OnMesg(deviceInfoMesg);
+		deviceInfoMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DEVICE_AUX_BATTERY_INFO: {
-		DeviceAuxBatteryInfoMesg deviceAuxBatteryInfoMesg(mesg);
+		DeviceAuxBatteryInfoMesg deviceAuxBatteryInfoMesg;
+		deviceAuxBatteryInfoMesg.Swap(mesg);
 		for (int i = 0; i < (int)deviceAuxBatteryInfoMesgListeners.size(); i++)
 			deviceAuxBatteryInfoMesgListeners[i]->OnMesg(deviceAuxBatteryInfoMesg);
+		deviceAuxBatteryInfoMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_TRAINING_FILE: {
-		TrainingFileMesg trainingFileMesg(mesg);
+		TrainingFileMesg trainingFileMesg;
+		trainingFileMesg.Swap(mesg);
 		for (int i = 0; i < (int)trainingFileMesgListeners.size(); i++)
 			trainingFileMesgListeners[i]->OnMesg(trainingFileMesg);
+		trainingFileMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_WEATHER_CONDITIONS: {
-		WeatherConditionsMesg weatherConditionsMesg(mesg);
+		WeatherConditionsMesg weatherConditionsMesg;
+		weatherConditionsMesg.Swap(mesg);
 		for (int i = 0; i < (int)weatherConditionsMesgListeners.size(); i++)
 			weatherConditionsMesgListeners[i]->OnMesg(weatherConditionsMesg);
+		weatherConditionsMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_WEATHER_ALERT: {
-		WeatherAlertMesg weatherAlertMesg(mesg);
+		WeatherAlertMesg weatherAlertMesg;
+		weatherAlertMesg.Swap(mesg);
 		for (int i = 0; i < (int)weatherAlertMesgListeners.size(); i++)
 			weatherAlertMesgListeners[i]->OnMesg(weatherAlertMesg);
+		weatherAlertMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_GPS_METADATA: {
-		GpsMetadataMesg gpsMetadataMesg(mesg);
+		GpsMetadataMesg gpsMetadataMesg;
+		gpsMetadataMesg.Swap(mesg);
 		for (int i = 0; i < (int)gpsMetadataMesgListeners.size(); i++)
 			gpsMetadataMesgListeners[i]->OnMesg(gpsMetadataMesg);
+		gpsMetadataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_CAMERA_EVENT: {
-		CameraEventMesg cameraEventMesg(mesg);
+		CameraEventMesg cameraEventMesg;
+		cameraEventMesg.Swap(mesg);
 		for (int i = 0; i < (int)cameraEventMesgListeners.size(); i++)
 			cameraEventMesgListeners[i]->OnMesg(cameraEventMesg);
+		cameraEventMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_GYROSCOPE_DATA: {
-		GyroscopeDataMesg gyroscopeDataMesg(mesg);
+		GyroscopeDataMesg gyroscopeDataMesg;
+		gyroscopeDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)gyroscopeDataMesgListeners.size(); i++)
 			gyroscopeDataMesgListeners[i]->OnMesg(gyroscopeDataMesg);
+		gyroscopeDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_ACCELEROMETER_DATA: {
-		AccelerometerDataMesg accelerometerDataMesg(mesg);
+		AccelerometerDataMesg accelerometerDataMesg;
+		accelerometerDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)accelerometerDataMesgListeners.size(); i++)
 			accelerometerDataMesgListeners[i]->OnMesg(accelerometerDataMesg);
+		accelerometerDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_MAGNETOMETER_DATA: {
-		MagnetometerDataMesg magnetometerDataMesg(mesg);
+		MagnetometerDataMesg magnetometerDataMesg;
+		magnetometerDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)magnetometerDataMesgListeners.size(); i++)
 			magnetometerDataMesgListeners[i]->OnMesg(magnetometerDataMesg);
+		magnetometerDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_BAROMETER_DATA: {
-		BarometerDataMesg barometerDataMesg(mesg);
+		BarometerDataMesg barometerDataMesg;
+		barometerDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)barometerDataMesgListeners.size(); i++)
 			barometerDataMesgListeners[i]->OnMesg(barometerDataMesg);
+		barometerDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_THREE_D_SENSOR_CALIBRATION: {
-		ThreeDSensorCalibrationMesg threeDSensorCalibrationMesg(mesg);
+		ThreeDSensorCalibrationMesg threeDSensorCalibrationMesg;
+		threeDSensorCalibrationMesg.Swap(mesg);
 		for (int i = 0; i < (int)threeDSensorCalibrationMesgListeners.size(); i++)
 			threeDSensorCalibrationMesgListeners[i]->OnMesg(threeDSensorCalibrationMesg);
+		threeDSensorCalibrationMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_ONE_D_SENSOR_CALIBRATION: {
-		OneDSensorCalibrationMesg oneDSensorCalibrationMesg(mesg);
+		OneDSensorCalibrationMesg oneDSensorCalibrationMesg;
+		oneDSensorCalibrationMesg.Swap(mesg);
 		for (int i = 0; i < (int)oneDSensorCalibrationMesgListeners.size(); i++)
 			oneDSensorCalibrationMesgListeners[i]->OnMesg(oneDSensorCalibrationMesg);
+		oneDSensorCalibrationMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_VIDEO_FRAME: {
-		VideoFrameMesg videoFrameMesg(mesg);
+		VideoFrameMesg videoFrameMesg;
+		videoFrameMesg.Swap(mesg);
 		for (int i = 0; i < (int)videoFrameMesgListeners.size(); i++)
 			videoFrameMesgListeners[i]->OnMesg(videoFrameMesg);
+		videoFrameMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_OBDII_DATA: {
-		ObdiiDataMesg obdiiDataMesg(mesg);
+		ObdiiDataMesg obdiiDataMesg;
+		obdiiDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)obdiiDataMesgListeners.size(); i++)
 			obdiiDataMesgListeners[i]->OnMesg(obdiiDataMesg);
+		obdiiDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_NMEA_SENTENCE: {
-		NmeaSentenceMesg nmeaSentenceMesg(mesg);
+		NmeaSentenceMesg nmeaSentenceMesg;
+		nmeaSentenceMesg.Swap(mesg);
 		for (int i = 0; i < (int)nmeaSentenceMesgListeners.size(); i++)
 			nmeaSentenceMesgListeners[i]->OnMesg(nmeaSentenceMesg);
+		nmeaSentenceMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_AVIATION_ATTITUDE: {
-		AviationAttitudeMesg aviationAttitudeMesg(mesg);
+		AviationAttitudeMesg aviationAttitudeMesg;
+		aviationAttitudeMesg.Swap(mesg);
 		for (int i = 0; i < (int)aviationAttitudeMesgListeners.size(); i++)
 			aviationAttitudeMesgListeners[i]->OnMesg(aviationAttitudeMesg);
+		aviationAttitudeMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_VIDEO: {
-		VideoMesg videoMesg(mesg);
+		VideoMesg videoMesg;
+		videoMesg.Swap(mesg);
 		for (int i = 0; i < (int)videoMesgListeners.size(); i++)
 			videoMesgListeners[i]->OnMesg(videoMesg);
+		videoMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_VIDEO_TITLE: {
-		VideoTitleMesg videoTitleMesg(mesg);
+		VideoTitleMesg videoTitleMesg;
+		videoTitleMesg.Swap(mesg);
 		for (int i = 0; i < (int)videoTitleMesgListeners.size(); i++)
 			videoTitleMesgListeners[i]->OnMesg(videoTitleMesg);
+		videoTitleMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_VIDEO_DESCRIPTION: {
-		VideoDescriptionMesg videoDescriptionMesg(mesg);
+		VideoDescriptionMesg videoDescriptionMesg;
+		videoDescriptionMesg.Swap(mesg);
 		for (int i = 0; i < (int)videoDescriptionMesgListeners.size(); i++)
 			videoDescriptionMesgListeners[i]->OnMesg(videoDescriptionMesg);
+		videoDescriptionMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_VIDEO_CLIP: {
-		VideoClipMesg videoClipMesg(mesg);
+		VideoClipMesg videoClipMesg;
+		videoClipMesg.Swap(mesg);
 		for (int i = 0; i < (int)videoClipMesgListeners.size(); i++)
 			videoClipMesgListeners[i]->OnMesg(videoClipMesg);
+		videoClipMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SET: {
-		SetMesg setMesg(mesg);
+		SetMesg setMesg;
+		setMesg.Swap(mesg);
 		for (int i = 0; i < (int)setMesgListeners.size(); i++)
 			setMesgListeners[i]->OnMesg(setMesg);
+		setMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_JUMP: {
-		JumpMesg jumpMesg(mesg);
+		JumpMesg jumpMesg;
+		jumpMesg.Swap(mesg);
 		for (int i = 0; i < (int)jumpMesgListeners.size(); i++)
 			jumpMesgListeners[i]->OnMesg(jumpMesg);
+		jumpMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SPLIT: {
-		SplitMesg splitMesg(mesg);
+		SplitMesg splitMesg;
+		splitMesg.Swap(mesg);
 		for (int i = 0; i < (int)splitMesgListeners.size(); i++)
 			splitMesgListeners[i]->OnMesg(splitMesg);
+		splitMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SPLIT_SUMMARY: {
-		SplitSummaryMesg splitSummaryMesg(mesg);
+		SplitSummaryMesg splitSummaryMesg;
+		splitSummaryMesg.Swap(mesg);
 		for (int i = 0; i < (int)splitSummaryMesgListeners.size(); i++)
 			splitSummaryMesgListeners[i]->OnMesg(splitSummaryMesg);
+		splitSummaryMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_CLIMB_PRO: {
-		ClimbProMesg climbProMesg(mesg);
+		ClimbProMesg climbProMesg;
+		climbProMesg.Swap(mesg);
 		for (int i = 0; i < (int)climbProMesgListeners.size(); i++)
 			climbProMesgListeners[i]->OnMesg(climbProMesg);
+		climbProMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_FIELD_DESCRIPTION: {
-		FieldDescriptionMesg fieldDescriptionMesg(mesg);
+		FieldDescriptionMesg fieldDescriptionMesg;
+		fieldDescriptionMesg.Swap(mesg);
 		for (int i = 0; i < (int)fieldDescriptionMesgListeners.size(); i++)
 			fieldDescriptionMesgListeners[i]->OnMesg(fieldDescriptionMesg);
+		fieldDescriptionMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DEVELOPER_DATA_ID: {
-		DeveloperDataIdMesg developerDataIdMesg(mesg);
+		DeveloperDataIdMesg developerDataIdMesg;
+		developerDataIdMesg.Swap(mesg);
 		for (int i = 0; i < (int)developerDataIdMesgListeners.size(); i++)
 			developerDataIdMesgListeners[i]->OnMesg(developerDataIdMesg);
+		developerDataIdMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_COURSE: {
-		CourseMesg courseMesg(mesg);
+		CourseMesg courseMesg;
+		courseMesg.Swap(mesg);
 		for (int i = 0; i < (int)courseMesgListeners.size(); i++)
 			courseMesgListeners[i]->OnMesg(courseMesg);
+		courseMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_COURSE_POINT: {
-		CoursePointMesg coursePointMesg(mesg);
+		CoursePointMesg coursePointMesg;
+		coursePointMesg.Swap(mesg);
 		for (int i = 0; i < (int)coursePointMesgListeners.size(); i++)
 			coursePointMesgListeners[i]->OnMesg(coursePointMesg);
+		coursePointMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SEGMENT_ID: {
-		SegmentIdMesg segmentIdMesg(mesg);
+		SegmentIdMesg segmentIdMesg;
+		segmentIdMesg.Swap(mesg);
 		for (int i = 0; i < (int)segmentIdMesgListeners.size(); i++)
 			segmentIdMesgListeners[i]->OnMesg(segmentIdMesg);
+		segmentIdMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SEGMENT_LEADERBOARD_ENTRY: {
-		SegmentLeaderboardEntryMesg segmentLeaderboardEntryMesg(mesg);
+		SegmentLeaderboardEntryMesg segmentLeaderboardEntryMesg;
+		segmentLeaderboardEntryMesg.Swap(mesg);
 		for (int i = 0; i < (int)segmentLeaderboardEntryMesgListeners.size(); i++)
 			segmentLeaderboardEntryMesgListeners[i]->OnMesg(segmentLeaderboardEntryMesg);
+		segmentLeaderboardEntryMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SEGMENT_POINT: {
-		SegmentPointMesg segmentPointMesg(mesg);
+		SegmentPointMesg segmentPointMesg;
+		segmentPointMesg.Swap(mesg);
 		for (int i = 0; i < (int)segmentPointMesgListeners.size(); i++)
 			segmentPointMesgListeners[i]->OnMesg(segmentPointMesg);
+		segmentPointMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SEGMENT_LAP: {
-		SegmentLapMesg segmentLapMesg(mesg);
+		SegmentLapMesg segmentLapMesg;
+		segmentLapMesg.Swap(mesg);
 		for (int i = 0; i < (int)segmentLapMesgListeners.size(); i++)
 			segmentLapMesgListeners[i]->OnMesg(segmentLapMesg);
 		mesgWithEventBroadcaster.OnMesg(segmentLapMesg);
+		segmentLapMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SEGMENT_FILE: {
-		SegmentFileMesg segmentFileMesg(mesg);
+		SegmentFileMesg segmentFileMesg;
+		segmentFileMesg.Swap(mesg);
 		for (int i = 0; i < (int)segmentFileMesgListeners.size(); i++)
 			segmentFileMesgListeners[i]->OnMesg(segmentFileMesg);
+		segmentFileMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_WORKOUT: {
-		WorkoutMesg workoutMesg(mesg);
+		WorkoutMesg workoutMesg;
+		workoutMesg.Swap(mesg);
 		for (int i = 0; i < (int)workoutMesgListeners.size(); i++)
 			workoutMesgListeners[i]->OnMesg(workoutMesg);
+		workoutMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_WORKOUT_SESSION: {
-		WorkoutSessionMesg workoutSessionMesg(mesg);
+		WorkoutSessionMesg workoutSessionMesg;
+		workoutSessionMesg.Swap(mesg);
 		for (int i = 0; i < (int)workoutSessionMesgListeners.size(); i++)
 			workoutSessionMesgListeners[i]->OnMesg(workoutSessionMesg);
+		workoutSessionMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_WORKOUT_STEP: {
-		WorkoutStepMesg workoutStepMesg(mesg);
+		WorkoutStepMesg workoutStepMesg;
+		workoutStepMesg.Swap(mesg);
 		for (int i = 0; i < (int)workoutStepMesgListeners.size(); i++)
 			workoutStepMesgListeners[i]->OnMesg(workoutStepMesg);
+		workoutStepMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_EXERCISE_TITLE: {
-		ExerciseTitleMesg exerciseTitleMesg(mesg);
+		ExerciseTitleMesg exerciseTitleMesg;
+		exerciseTitleMesg.Swap(mesg);
 		for (int i = 0; i < (int)exerciseTitleMesgListeners.size(); i++)
 			exerciseTitleMesgListeners[i]->OnMesg(exerciseTitleMesg);
+		exerciseTitleMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SCHEDULE: {
-		ScheduleMesg scheduleMesg(mesg);
+		ScheduleMesg scheduleMesg;
+		scheduleMesg.Swap(mesg);
 		for (int i = 0; i < (int)scheduleMesgListeners.size(); i++)
 			scheduleMesgListeners[i]->OnMesg(scheduleMesg);
+		scheduleMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_TOTALS: {
-		TotalsMesg totalsMesg(mesg);
+		TotalsMesg totalsMesg;
+		totalsMesg.Swap(mesg);
 		for (int i = 0; i < (int)totalsMesgListeners.size(); i++)
 			totalsMesgListeners[i]->OnMesg(totalsMesg);
+		totalsMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_WEIGHT_SCALE: {
-		WeightScaleMesg weightScaleMesg(mesg);
+		WeightScaleMesg weightScaleMesg;
+		weightScaleMesg.Swap(mesg);
 		for (int i = 0; i < (int)weightScaleMesgListeners.size(); i++)
 			weightScaleMesgListeners[i]->OnMesg(weightScaleMesg);
+		weightScaleMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_BLOOD_PRESSURE: {
-		BloodPressureMesg bloodPressureMesg(mesg);
+		BloodPressureMesg bloodPressureMesg;
+		bloodPressureMesg.Swap(mesg);
 		for (int i = 0; i < (int)bloodPressureMesgListeners.size(); i++)
 			bloodPressureMesgListeners[i]->OnMesg(bloodPressureMesg);
+		bloodPressureMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_MONITORING_INFO: {
-		MonitoringInfoMesg monitoringInfoMesg(mesg);
+		MonitoringInfoMesg monitoringInfoMesg;
+		monitoringInfoMesg.Swap(mesg);
 		for (int i = 0; i < (int)monitoringInfoMesgListeners.size(); i++)
 			monitoringInfoMesgListeners[i]->OnMesg(monitoringInfoMesg);
+		monitoringInfoMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_MONITORING: {
-		MonitoringMesg monitoringMesg(mesg);
+		MonitoringMesg monitoringMesg;
+		monitoringMesg.Swap(mesg);
 		for (int i = 0; i < (int)monitoringMesgListeners.size(); i++)
 			monitoringMesgListeners[i]->OnMesg(monitoringMesg);
+		monitoringMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_MONITORING_HR_DATA: {
-		MonitoringHrDataMesg monitoringHrDataMesg(mesg);
+		MonitoringHrDataMesg monitoringHrDataMesg;
+		monitoringHrDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)monitoringHrDataMesgListeners.size(); i++)
 			monitoringHrDataMesgListeners[i]->OnMesg(monitoringHrDataMesg);
+		monitoringHrDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SPO2_DATA: {
-		Spo2DataMesg spo2DataMesg(mesg);
+		Spo2DataMesg spo2DataMesg;
+		spo2DataMesg.Swap(mesg);
 		for (int i = 0; i < (int)spo2DataMesgListeners.size(); i++)
 			spo2DataMesgListeners[i]->OnMesg(spo2DataMesg);
+		spo2DataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HR: {
-		HrMesg hrMesg(mesg);
+		HrMesg hrMesg;
+		hrMesg.Swap(mesg);
 		for (int i = 0; i < (int)hrMesgListeners.size(); i++)
 			hrMesgListeners[i]->OnMesg(hrMesg);
+		hrMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_STRESS_LEVEL: {
-		StressLevelMesg stressLevelMesg(mesg);
+		StressLevelMesg stressLevelMesg;
+		stressLevelMesg.Swap(mesg);
 		for (int i = 0; i < (int)stressLevelMesgListeners.size(); i++)
 			stressLevelMesgListeners[i]->OnMesg(stressLevelMesg);
+		stressLevelMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_MAX_MET_DATA: {
-		MaxMetDataMesg maxMetDataMesg(mesg);
+		MaxMetDataMesg maxMetDataMesg;
+		maxMetDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)maxMetDataMesgListeners.size(); i++)
 			maxMetDataMesgListeners[i]->OnMesg(maxMetDataMesg);
+		maxMetDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_BODY_BATTERY_DATA: {
-		HsaBodyBatteryDataMesg hsaBodyBatteryDataMesg(mesg);
+		HsaBodyBatteryDataMesg hsaBodyBatteryDataMesg;
+		hsaBodyBatteryDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaBodyBatteryDataMesgListeners.size(); i++)
 			hsaBodyBatteryDataMesgListeners[i]->OnMesg(hsaBodyBatteryDataMesg);
+		hsaBodyBatteryDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_EVENT: {
-		HsaEventMesg hsaEventMesg(mesg);
+		HsaEventMesg hsaEventMesg;
+		hsaEventMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaEventMesgListeners.size(); i++)
 			hsaEventMesgListeners[i]->OnMesg(hsaEventMesg);
+		hsaEventMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_ACCELEROMETER_DATA: {
-		HsaAccelerometerDataMesg hsaAccelerometerDataMesg(mesg);
+		HsaAccelerometerDataMesg hsaAccelerometerDataMesg;
+		hsaAccelerometerDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaAccelerometerDataMesgListeners.size(); i++)
 			hsaAccelerometerDataMesgListeners[i]->OnMesg(hsaAccelerometerDataMesg);
+		hsaAccelerometerDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_GYROSCOPE_DATA: {
-		HsaGyroscopeDataMesg hsaGyroscopeDataMesg(mesg);
+		HsaGyroscopeDataMesg hsaGyroscopeDataMesg;
+		hsaGyroscopeDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaGyroscopeDataMesgListeners.size(); i++)
 			hsaGyroscopeDataMesgListeners[i]->OnMesg(hsaGyroscopeDataMesg);
+		hsaGyroscopeDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_STEP_DATA: {
-		HsaStepDataMesg hsaStepDataMesg(mesg);
+		HsaStepDataMesg hsaStepDataMesg;
+		hsaStepDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaStepDataMesgListeners.size(); i++)
 			hsaStepDataMesgListeners[i]->OnMesg(hsaStepDataMesg);
+		hsaStepDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_SPO2_DATA: {
-		HsaSpo2DataMesg hsaSpo2DataMesg(mesg);
+		HsaSpo2DataMesg hsaSpo2DataMesg;
+		hsaSpo2DataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaSpo2DataMesgListeners.size(); i++)
 			hsaSpo2DataMesgListeners[i]->OnMesg(hsaSpo2DataMesg);
+		hsaSpo2DataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_STRESS_DATA: {
-		HsaStressDataMesg hsaStressDataMesg(mesg);
+		HsaStressDataMesg hsaStressDataMesg;
+		hsaStressDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaStressDataMesgListeners.size(); i++)
 			hsaStressDataMesgListeners[i]->OnMesg(hsaStressDataMesg);
+		hsaStressDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_RESPIRATION_DATA: {
-		HsaRespirationDataMesg hsaRespirationDataMesg(mesg);
+		HsaRespirationDataMesg hsaRespirationDataMesg;
+		hsaRespirationDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaRespirationDataMesgListeners.size(); i++)
 			hsaRespirationDataMesgListeners[i]->OnMesg(hsaRespirationDataMesg);
+		hsaRespirationDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_HEART_RATE_DATA: {
-		HsaHeartRateDataMesg hsaHeartRateDataMesg(mesg);
+		HsaHeartRateDataMesg hsaHeartRateDataMesg;
+		hsaHeartRateDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaHeartRateDataMesgListeners.size(); i++)
 			hsaHeartRateDataMesgListeners[i]->OnMesg(hsaHeartRateDataMesg);
+		hsaHeartRateDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_CONFIGURATION_DATA: {
-		HsaConfigurationDataMesg hsaConfigurationDataMesg(mesg);
+		HsaConfigurationDataMesg hsaConfigurationDataMesg;
+		hsaConfigurationDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaConfigurationDataMesgListeners.size(); i++)
 			hsaConfigurationDataMesgListeners[i]->OnMesg(hsaConfigurationDataMesg);
+		hsaConfigurationDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HSA_WRIST_TEMPERATURE_DATA: {
-		HsaWristTemperatureDataMesg hsaWristTemperatureDataMesg(mesg);
+		HsaWristTemperatureDataMesg hsaWristTemperatureDataMesg;
+		hsaWristTemperatureDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)hsaWristTemperatureDataMesgListeners.size(); i++)
 			hsaWristTemperatureDataMesgListeners[i]->OnMesg(hsaWristTemperatureDataMesg);
+		hsaWristTemperatureDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_MEMO_GLOB: {
-		MemoGlobMesg memoGlobMesg(mesg);
+		MemoGlobMesg memoGlobMesg;
+		memoGlobMesg.Swap(mesg);
 		for (int i = 0; i < (int)memoGlobMesgListeners.size(); i++)
 			memoGlobMesgListeners[i]->OnMesg(memoGlobMesg);
+		memoGlobMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SLEEP_LEVEL: {
-		SleepLevelMesg sleepLevelMesg(mesg);
+		SleepLevelMesg sleepLevelMesg;
+		sleepLevelMesg.Swap(mesg);
 		for (int i = 0; i < (int)sleepLevelMesgListeners.size(); i++)
 			sleepLevelMesgListeners[i]->OnMesg(sleepLevelMesg);
+		sleepLevelMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_ANT_CHANNEL_ID: {
-		AntChannelIdMesg antChannelIdMesg(mesg);
+		AntChannelIdMesg antChannelIdMesg;
+		antChannelIdMesg.Swap(mesg);
 		for (int i = 0; i < (int)antChannelIdMesgListeners.size(); i++)
 			antChannelIdMesgListeners[i]->OnMesg(antChannelIdMesg);
+		antChannelIdMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_ANT_RX: {
-		AntRxMesg antRxMesg(mesg);
+		AntRxMesg antRxMesg;
+		antRxMesg.Swap(mesg);
 		for (int i = 0; i < (int)antRxMesgListeners.size(); i++)
 			antRxMesgListeners[i]->OnMesg(antRxMesg);
+		antRxMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_ANT_TX: {
-		AntTxMesg antTxMesg(mesg);
+		AntTxMesg antTxMesg;
+		antTxMesg.Swap(mesg);
 		for (int i = 0; i < (int)antTxMesgListeners.size(); i++)
 			antTxMesgListeners[i]->OnMesg(antTxMesg);
+		antTxMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_EXD_SCREEN_CONFIGURATION: {
-		ExdScreenConfigurationMesg exdScreenConfigurationMesg(mesg);
+		ExdScreenConfigurationMesg exdScreenConfigurationMesg;
+		exdScreenConfigurationMesg.Swap(mesg);
 		for (int i = 0; i < (int)exdScreenConfigurationMesgListeners.size(); i++)
 			exdScreenConfigurationMesgListeners[i]->OnMesg(exdScreenConfigurationMesg);
+		exdScreenConfigurationMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_EXD_DATA_FIELD_CONFIGURATION: {
-		ExdDataFieldConfigurationMesg exdDataFieldConfigurationMesg(mesg);
+		ExdDataFieldConfigurationMesg exdDataFieldConfigurationMesg;
+		exdDataFieldConfigurationMesg.Swap(mesg);
 		for (int i = 0; i < (int)exdDataFieldConfigurationMesgListeners.size(); i++)
 			exdDataFieldConfigurationMesgListeners[i]->OnMesg(exdDataFieldConfigurationMesg);
+		exdDataFieldConfigurationMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_EXD_DATA_CONCEPT_CONFIGURATION: {
-		ExdDataConceptConfigurationMesg exdDataConceptConfigurationMesg(mesg);
+		ExdDataConceptConfigurationMesg exdDataConceptConfigurationMesg;
+		exdDataConceptConfigurationMesg.Swap(mesg);
 		for (int i = 0; i < (int)exdDataConceptConfigurationMesgListeners.size(); i++)
 			exdDataConceptConfigurationMesgListeners[i]->OnMesg(exdDataConceptConfigurationMesg);
+		exdDataConceptConfigurationMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_DIVE_SUMMARY: {
-		DiveSummaryMesg diveSummaryMesg(mesg);
+		DiveSummaryMesg diveSummaryMesg;
+		diveSummaryMesg.Swap(mesg);
 		for (int i = 0; i < (int)diveSummaryMesgListeners.size(); i++)
 			diveSummaryMesgListeners[i]->OnMesg(diveSummaryMesg);
+		diveSummaryMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_AAD_ACCEL_FEATURES: {
-		AadAccelFeaturesMesg aadAccelFeaturesMesg(mesg);
+		AadAccelFeaturesMesg aadAccelFeaturesMesg;
+		aadAccelFeaturesMesg.Swap(mesg);
 		for (int i = 0; i < (int)aadAccelFeaturesMesgListeners.size(); i++)
 			aadAccelFeaturesMesgListeners[i]->OnMesg(aadAccelFeaturesMesg);
+		aadAccelFeaturesMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HRV: {
-		HrvMesg hrvMesg(mesg);
+		HrvMesg hrvMesg;
+		hrvMesg.Swap(mesg);
 		for (int i = 0; i < (int)hrvMesgListeners.size(); i++)
 			hrvMesgListeners[i]->OnMesg(hrvMesg);
+		hrvMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_BEAT_INTERVALS: {
-		BeatIntervalsMesg beatIntervalsMesg(mesg);
+		BeatIntervalsMesg beatIntervalsMesg;
+		beatIntervalsMesg.Swap(mesg);
 		for (int i = 0; i < (int)beatIntervalsMesgListeners.size(); i++)
 			beatIntervalsMesgListeners[i]->OnMesg(beatIntervalsMesg);
+		beatIntervalsMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HRV_STATUS_SUMMARY: {
-		HrvStatusSummaryMesg hrvStatusSummaryMesg(mesg);
+		HrvStatusSummaryMesg hrvStatusSummaryMesg;
+		hrvStatusSummaryMesg.Swap(mesg);
 		for (int i = 0; i < (int)hrvStatusSummaryMesgListeners.size(); i++)
 			hrvStatusSummaryMesgListeners[i]->OnMesg(hrvStatusSummaryMesg);
+		hrvStatusSummaryMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_HRV_VALUE: {
-		HrvValueMesg hrvValueMesg(mesg);
+		HrvValueMesg hrvValueMesg;
+		hrvValueMesg.Swap(mesg);
 		for (int i = 0; i < (int)hrvValueMesgListeners.size(); i++)
 			hrvValueMesgListeners[i]->OnMesg(hrvValueMesg);
+		hrvValueMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_RAW_BBI: {
-		RawBbiMesg rawBbiMesg(mesg);
+		RawBbiMesg rawBbiMesg;
+		rawBbiMesg.Swap(mesg);
 		for (int i = 0; i < (int)rawBbiMesgListeners.size(); i++)
 			rawBbiMesgListeners[i]->OnMesg(rawBbiMesg);
+		rawBbiMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_RESPIRATION_RATE: {
-		RespirationRateMesg respirationRateMesg(mesg);
+		RespirationRateMesg respirationRateMesg;
+		respirationRateMesg.Swap(mesg);
 		for (int i = 0; i < (int)respirationRateMesgListeners.size(); i++)
 			respirationRateMesgListeners[i]->OnMesg(respirationRateMesg);
+		respirationRateMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_CHRONO_SHOT_SESSION: {
-		ChronoShotSessionMesg chronoShotSessionMesg(mesg);
+		ChronoShotSessionMesg chronoShotSessionMesg;
+		chronoShotSessionMesg.Swap(mesg);
 		for (int i = 0; i < (int)chronoShotSessionMesgListeners.size(); i++)
 			chronoShotSessionMesgListeners[i]->OnMesg(chronoShotSessionMesg);
+		chronoShotSessionMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_CHRONO_SHOT_DATA: {
-		ChronoShotDataMesg chronoShotDataMesg(mesg);
+		ChronoShotDataMesg chronoShotDataMesg;
+		chronoShotDataMesg.Swap(mesg);
 		for (int i = 0; i < (int)chronoShotDataMesgListeners.size(); i++)
 			chronoShotDataMesgListeners[i]->OnMesg(chronoShotDataMesg);
+		chronoShotDataMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_TANK_UPDATE: {
-		TankUpdateMesg tankUpdateMesg(mesg);
+		TankUpdateMesg tankUpdateMesg;
+		tankUpdateMesg.Swap(mesg);
 		for (int i = 0; i < (int)tankUpdateMesgListeners.size(); i++)
 			tankUpdateMesgListeners[i]->OnMesg(tankUpdateMesg);
+		tankUpdateMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_TANK_SUMMARY: {
-		TankSummaryMesg tankSummaryMesg(mesg);
+		TankSummaryMesg tankSummaryMesg;
+		tankSummaryMesg.Swap(mesg);
 		for (int i = 0; i < (int)tankSummaryMesgListeners.size(); i++)
 			tankSummaryMesgListeners[i]->OnMesg(tankSummaryMesg);
+		tankSummaryMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SLEEP_ASSESSMENT: {
-		SleepAssessmentMesg sleepAssessmentMesg(mesg);
+		SleepAssessmentMesg sleepAssessmentMesg;
+		sleepAssessmentMesg.Swap(mesg);
 		for (int i = 0; i < (int)sleepAssessmentMesgListeners.size(); i++)
 			sleepAssessmentMesgListeners[i]->OnMesg(sleepAssessmentMesg);
+		sleepAssessmentMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_SKIN_TEMP_OVERNIGHT: {
-		SkinTempOvernightMesg skinTempOvernightMesg(mesg);
+		SkinTempOvernightMesg skinTempOvernightMesg;
+		skinTempOvernightMesg.Swap(mesg);
 		for (int i = 0; i < (int)skinTempOvernightMesgListeners.size(); i++)
 			skinTempOvernightMesgListeners[i]->OnMesg(skinTempOvernightMesg);
+		skinTempOvernightMesg.Swap(mesg);
 		break;
 	}
 	case FIT_MESG_NUM_PAD: {
-		PadMesg padMesg(mesg);
+		PadMesg padMesg;
+		padMesg.Swap(mesg);
 		for (int i = 0; i < (int)padMesgListeners.size(); i++)
 			padMesgListeners[i]->OnMesg(padMesg);
+		padMesg.Swap(mesg);
 		break;
 	}
 
@@ -11,6 +11,9 @@
 
 #include "fit_profile.hpp"
 
+#include <unordered_map>
+#include <vector>
+
 namespace fit {
 
 static const Profile::SUBFIELD_MAP fileIdProductFaveroProductMaps[] = {
@@ -3031,36 +3034,87 @@ const Profile::MESG Profile::mesgs[MESGS] = {
     {NULL, "pad", FIT_MESG_NUM_PAD, 0},
 };
 
-const Profile::MESG *Profile::GetMesg(const FIT_UINT16 num) {
-	for (int i = 0; i < MESGS; i++) {
-		if (mesgs[i].num == num)
-			return &mesgs[i];
+namespace {
+
+// Direct index tables over the generated profile. MESG and FIELD hold std::string
+// members, so the tables cannot be constant-initialized and are built on first use.
+class ProfileIndex {
+public:
+	ProfileIndex() : fieldIndexes(Profile::MESGS * FieldsPerMesg, FIT_UINT16_INVALID) {
+		FIT_UINT16 maxNum = 0;
+		for (int i = 0; i < Profile::MESGS; i++) {
+			if (Profile::mesgs[i].num > maxNum)
+				maxNum = Profile::mesgs[i].num;
+		}
+
+		mesgIndexes.assign((size_t)maxNum + 1, FIT_UINT16_INVALID);
+
+		for (int i = Profile::MESGS - 1; i >= 0; i--) {
+			const Profile::MESG &mesg = Profile::mesgs[i];
+
+			// The first entry wins, as with the linear search.
+			mesgIndexes[mesg.num] = (FIT_UINT16)i;
+			mesgNames[mesg.name] = (FIT_UINT16)i;
+
+			for (int j = mesg.numFields - 1; j >= 0; j--)
+				fieldIndexes[(size_t)i * FieldsPerMesg + mesg.fields[j].num] = (FIT_UINT16)j;
+		}
 	}
 
-	return NULL;
+	FIT_UINT16 GetMesgIndex(const FIT_UINT16 num) const {
+		return (num < mesgIndexes.size()) ? mesgIndexes[num] : FIT_UINT16_INVALID;
+	}
+
+	FIT_UINT16 GetMesgIndex(const std::string &name) const {
+		std::unordered_map<std::string, FIT_UINT16>::const_iterator it = mesgNames.find(name);
+		return (it != mesgNames.end()) ? it->second : FIT_UINT16_INVALID;
+	}
+
+	FIT_UINT16 GetFieldIndex(const FIT_UINT16 mesgIndex, const FIT_UINT8 fieldNum) const {
+		return fieldIndexes[(size_t)mesgIndex * FieldsPerMesg + fieldNum];
+	}
+
+private:
+	static const size_t FieldsPerMesg = 256;
+
+	std::vector<FIT_UINT16> mesgIndexes;
+	std::vector<FIT_UINT16> fieldIndexes;
+	std::unordered_map<std::string, FIT_UINT16> mesgNames;
+};
+
+const ProfileIndex &GetProfileIndex(void) {
+	static const ProfileIndex index;
+	return index;
+}
+
+} // namespace
+
+const Profile::MESG *Profile::GetMesg(const FIT_UINT16 num) {
+	FIT_UINT16 index = GetProfileIndex().GetMesgIndex(num);
+
+	if (index == FIT_UINT16_INVALID)
+		return NULL;
+
+	return &mesgs[index];
 }
 
 const Profile::MESG *Profile::GetMesg(const std::string &name) {
-	for (int i = 0; i < MESGS; i++) {
-		if (mesgs[i].name == name)
-			return &mesgs[i];
-	}
+	FIT_UINT16 index = GetProfileIndex().GetMesgIndex(name);
 
-	return NULL;
+	if (index == FIT_UINT16_INVALID)
+		return NULL;
+
+	return &mesgs[index];
 }
 
 const FIT_UINT16 Profile::GetFieldIndex(const FIT_UINT16 mesgNum, const FIT_UINT8 fieldNum) {
-	const MESG *mesg = GetMesg(mesgNum);
+	const ProfileIndex &profileIndex = GetProfileIndex();
+	FIT_UINT16 index = profileIndex.GetMesgIndex(mesgNum);
 
-	if (mesg == NULL)
+	if (index == FIT_UINT16_INVALID)
 		return FIT_UINT16_INVALID;
 
-	for (FIT_UINT16 i = 0; i < mesg->numFields; i++) {
-		if (mesg->fields[i].num == fieldNum)
-			return i;
-	}
-
-	return FIT_UINT16_INVALID;
+	return profileIndex.GetFieldIndex(index, fieldNum);
 }
 
 const FIT_UINT16 Profile::GetFieldIndex(const std::string &mesgName, const std::string &fieldName) {
@@ -3083,17 +3137,18 @@ const FIT_UINT16 Profile::GetFieldIndex(const std::string &mesgName, const std::
 }
 
 const Profile::FIELD *Profile::GetField(const FIT_UINT16 mesgNum, const FIT_UINT8 fieldNum) {
-	const MESG *mesg = GetMesg(mesgNum);
+	const ProfileIndex &profileIndex = GetProfileIndex();
+	FIT_UINT16 index = profileIndex.GetMesgIndex(mesgNum);
 
-	if (mesg == NULL)
+	if (index == FIT_UINT16_INVALID)
 		return NULL;
 
-	FIT_UINT16 fieldIndex = GetFieldIndex(mesgNum, fieldNum);
+	FIT_UINT16 fieldIndex = profileIndex.GetFieldIndex(index, fieldNum);
 
-	if (fieldIndex >= mesg->numFields)
+	if (fieldIndex == FIT_UINT16_INVALID)
 		return NULL;
 
-	return &(mesg->fields[fieldIndex]);
+	return &(mesgs[index].fields[fieldIndex]);
 }
 
 const Profile::FIELD *Profile::GetField(const std::string &mesgName, const std::string &fieldName) {
@@ -3127,20 +3182,15 @@ const FIT_UINT16 Profile::GetSubFieldIndex(const std::string &mesgName, const st
 
 const Profile::SUBFIELD *Profile::GetSubField(const FIT_UINT16 mesgNum, const FIT_UINT8 fieldNum,
                                               const FIT_UINT16 subFieldIndex) {
-	const MESG *mesg = GetMesg(mesgNum);
-
-	if (mesg == NULL)
-		return NULL;
+	const FIELD *field = GetField(mesgNum, fieldNum);
 
-	FIT_UINT16 fieldIndex = GetFieldIndex(mesgNum, fieldNum);
-
-	if (fieldIndex >= mesg->numFields)
+	if (field == NULL)
 		return NULL;
 
-	if (subFieldIndex >= mesg->fields[fieldIndex].numSubFields)
+	if (subFieldIndex >= field->numSubFields)
 		return NULL;
 
-	return &(mesg->fields[fieldIndex].subFields[subFieldIndex]);
+	return &(field->subFields[subFieldIndex]);
 }
 
 const Profile::SUBFIELD *Profile::GetSubField(const std::string &mesgName, const std::string &fieldName,
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "fit_mesg_definition.hpp"
+
+namespace fit {
+
+class RawMesgListener {
+public:
+	virtual ~RawMesgListener() {
+	}
+
+	virtual FIT_BOOL OnRawMesgDefinition(const MesgDefinition &mesgDef, FIT_BOOL bigEndian) = 0;
+	///////////////////////////////////////////////////////////////////////
+	// Called for every definition message the decoder can hand out raw.
+	// Parameters:
+	//    mesgDef      Definition of the following data messages.
+	//    bigEndian    True if multi-byte field values are big endian.
+	// Returns true to receive the data messages of this definition through
+	// OnRawMesg() instead of as decoded Mesg objects.
+	///////////////////////////////////////////////////////////////////////
+
+	virtual void OnRawMesg(const MesgDefinition &mesgDef, const FIT_UINT8 *data, FIT_UINT32 timestamp) = 0;
+	///////////////////////////////////////////////////////////////////////
+	// Called with the undecoded field data of a claimed message. No Mesg is
+	// built, so the listener is responsible for invalid values, scaling and
+	// component expansion.
+	// Parameters:
+	//    mesgDef      Definition of the message (see GetLocalNum()).
+	//    data         Field data in definition order, developer fields last.
+	//                 Only valid for the duration of the call.
+	//    timestamp    Timestamp of the message, from its timestamp field or
+	//                 compressed header, or FIT_DATE_TIME_INVALID.
+	///////////////////////////////////////////////////////////////////////
+};
+
+} // namespace fit
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <cstring>
+#include <type_traits>
+#include "fit.hpp"
+
+namespace fit {
+
+///////////////////////////////////////////////////////////////////////
+// Vector of trivially copyable elements holding up to N elements in
+// place. Only larger contents are allocated from the heap, so copying
+// a small vector never allocates. Implements the part of std::vector
+// the SDK uses.
+///////////////////////////////////////////////////////////////////////
+template <typename T, FIT_UINT32 N>
+class SmallVector {
+	static_assert(std::is_trivially_copyable<T>::value, "SmallVector elements are copied with memcpy");
+
+public:
+	typedef T *iterator;
+	typedef const T *const_iterator;
+
+	SmallVector(void) : elements(inlineElements), count(0), capacity(N) {
+	}
+
+	SmallVector(const SmallVector &other) : elements(inlineElements), count(0), capacity(N) {
+		Assign(other.elements, other.count);
+	}
+
+	~SmallVector() {
+		if (elements != inlineElements)
+			delete[] elements;
+	}
+
+	SmallVector &operator=(const SmallVector &other) {
+		if (this != &other)
+			Assign(other.elements, other.count);
+		return *this;
+	}
+
+	size_t size(void) const {
+		return count;
+	}
+
+	FIT_BOOL empty(void) const {
+		return count == 0;
+	}
+
+	T *data(void) {
+		return elements;
+	}
+
+	const T *data(void) const {
+		return elements;
+	}
+
+	iterator begin(void) {
+		return elements;
+	}
+
+	iterator end(void) {
+		return elements + count;
+	}
+
+	const_iterator begin(void) const {
+		return elements;
+	}
+
+	const_iterator end(void) const {
+		return elements + count;
+	}
+
+	T &operator[](size_t index) {
+		return elements[index];
+	}
+
+	const T &operator[](size_t index) const {
+		return elements[index];
+	}
+
+	T &back(void) {
+		return elements[count - 1];
+	}
+
+	const T &back(void) const {
+		return elements[count - 1];
+	}
+
+	void clear(void) {
+		count = 0;
+	}
+
+	void reserve(size_t size) {
+		if (size <= capacity)
+			return;
+
+		FIT_UINT32 newCapacity = capacity * 2;
+		if (newCapacity < size)
+			newCapacity = (FIT_UINT32)size;
+
+		T *newElements = new T[newCapacity];
+		memcpy(newElements, elements, count * sizeof(T));
+		if (elements != inlineElements)
+			delete[] elements;
+		elements = newElements;
+		capacity = newCapacity;
+	}
+
+	// New elements are value initialized, as by std::vector.
+	void resize(size_t size) {
+		reserve(size);
+		for (size_t i = count; i < size; i++)
+			elements[i] = T();
+		count = (FIT_UINT32)size;
+	}
+
+	void push_back(const T &value) {
+		T element = value; // The value may be an element of this vector.
+		reserve(count + 1);
+		elements[count++] = element;
+	}
+
+	iterator insert(iterator position, const T &value) {
+		size_t index = position - elements;
+		T element = value; // The value may be an element of this vector.
+
+		reserve(count + 1);
+		memmove(elements + index + 1, elements + index, (count - index) * sizeof(T));
+		elements[index] = element;
+		count++;
+		return elements + index;
+	}
+
+	// The inserted range must not be part of this vector.
+	iterator insert(iterator position, const T *first, const T *last) {
+		size_t index = position - elements;
+		size_t length = last - first;
+
+		reserve(count + length);
+		memmove(elements + index + length, elements + index, (count - index) * sizeof(T));
+		memcpy(elements + index, first, length * sizeof(T));
+		count += (FIT_UINT32)length;
+		return elements + index;
+	}
+
+	iterator erase(iterator first, iterator last) {
+		memmove(first, last, (end() - last) * sizeof(T));
+		count -= (FIT_UINT32)(last - first);
+		return first;
+	}
+
+private:
+	T *elements;
+	FIT_UINT32 count;
+	FIT_UINT32 capacity;
+	T inlineElements[N];
+
+	void Assign(const T *source, size_t size) {
+		count = 0;
+		reserve(size);
+		memcpy(elements, source, size * sizeof(T));
+		count = (FIT_UINT32)size;
+	}
+};
+
+} // namespace fit
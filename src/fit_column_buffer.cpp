@@ -0,0 +1,95 @@
+#include "fit_column_buffer.hpp"
+#include "fit_sidecar.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace duckdb {
+
+FitColumnBuffer::FitColumnBuffer(vector<idx_t> widths_p)
+    : widths(std::move(widths_p)), count(0), capacity(0), values(widths.size()), validity(widths.size()) {
+}
+
+idx_t FitColumnBuffer::AppendRow() {
+	if (count == capacity) {
+		// Grow all columns together, new values are zeroed and invalid
+		capacity = MaxValue<idx_t>(capacity * 2, STANDARD_VECTOR_SIZE);
+		for (idx_t column = 0; column < widths.size(); column++) {
+			values[column].resize(capacity * widths[column]);
+			validity[column].resize(ValidityEntries(capacity));
+		}
+	}
+	return count++;
+}
+
+data_ptr_t FitColumnBuffer::SetValid(idx_t column, idx_t row) {
+	validity[column][row / BITS_PER_ENTRY] |= uint64_t(1) << (row % BITS_PER_ENTRY);
+	return values[column].data() + row * widths[column];
+}
+
+const_data_ptr_t FitColumnBuffer::GetValue(idx_t column, idx_t row) const {
+	if (!(validity[column][row / BITS_PER_ENTRY] & (uint64_t(1) << (row % BITS_PER_ENTRY)))) {
+		return nullptr;
+	}
+	return values[column].data() + row * widths[column];
+}
+
+void FitColumnBuffer::Scan(idx_t column, idx_t offset, idx_t row_count, Vector &result) const {
+	memcpy(FlatVector::GetData(result), values[column].data() + offset * widths[column], row_count * widths[column]);
+
+	auto &column_validity = validity[column];
+	auto &result_validity = FlatVector::Validity(result);
+	idx_t i = 0;
+	while (i < row_count) {
+		idx_t row = offset + i;
+		uint64_t entry = column_validity[row / BITS_PER_ENTRY];
+		if (row % BITS_PER_ENTRY == 0 && i + BITS_PER_ENTRY <= row_count && entry == ~uint64_t(0)) {
+			// Whole entry valid, nothing to mark
+			i += BITS_PER_ENTRY;
+			continue;
+		}
+		if (!(entry & (uint64_t(1) << (row % BITS_PER_ENTRY)))) {
+			result_validity.SetInvalid(i);
+		}
+		i++;
+	}
+}
+
+idx_t FitColumnBuffer::GetMemoryUsage() const {
+	idx_t usage = 0;
+	for (idx_t column = 0; column < widths.size(); column++) {
+		usage += values[column].capacity() + validity[column].capacity() * sizeof(uint64_t);
+	}
+	return usage;
+}
+
+void FitColumnBuffer::Serialize(FitSidecarWriter &writer) const {
+	writer.Write<uint64_t>(count);
+	writer.Write<uint64_t>(widths.size());
+	for (idx_t column = 0; column < widths.size(); column++) {
+		writer.Write<uint64_t>(widths[column]);
+		writer.WriteData(values[column].data(), count * widths[column]);
+		writer.WriteData(reinterpret_cast<const_data_ptr_t>(validity[column].data()),
+		                 ValidityEntries(count) * sizeof(uint64_t));
+	}
+}
+
+void FitColumnBuffer::Deserialize(FitSidecarReader &reader) {
+	auto row_count = reader.Read<uint64_t>();
+	if (row_count > reader.Remaining() || reader.Read<uint64_t>() != widths.size()) {
+		throw std::runtime_error("FIT sidecar columns do not match");
+	}
+	count = capacity = row_count;
+	for (idx_t column = 0; column < widths.size(); column++) {
+		if (reader.Read<uint64_t>() != widths[column]) {
+			throw std::runtime_error("FIT sidecar columns do not match");
+		}
+		auto column_values = reader.ReadData(count * widths[column]);
+		values[column].assign(column_values, column_values + count * widths[column]);
+		validity[column].resize(ValidityEntries(count));
+		memcpy(validity[column].data(), reader.ReadData(ValidityEntries(count) * sizeof(uint64_t)),
+		       ValidityEntries(count) * sizeof(uint64_t));
+	}
+}
+
+} // namespace duckdb
@@ -1,12 +1,32 @@
 #define DUCKDB_EXTENSION_MAIN
 
 #include "fit_extension.hpp"
+#include "fit_column_buffer.hpp"
+#include "fit_field_extractor.hpp"
+#include "fit_file_buffer.hpp"
+#include "fit_file_cache.hpp"
+#include "fit_sidecar.hpp"
 #include "utils.hpp"
 #include "duckdb.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/function/scalar_function.hpp"
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/appender.hpp"
+#include "duckdb/main/config.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/planner/expression/bound_between_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/storage/statistics/node_statistics.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 #include <duckdb/parser/parsed_data/create_scalar_function_info.hpp>
 
 // OpenSSL linked through vcpkg
@@ -15,6 +35,8 @@
 // FIT SDK includes
 #include "fit_decode.hpp"
 #include "fit_mesg_broadcaster.hpp"
+#include "fit_profile.hpp"
+#include "fit_raw_mesg_listener.hpp"
 #include "fit_record_mesg.hpp"
 #include "fit_file_id_mesg.hpp"
 #include "fit_activity_mesg.hpp"
@@ -24,220 +46,21 @@
 #include "fit_event_mesg.hpp"
 #include "fit_user_profile_mesg.hpp"
 
-#include <fstream>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <algorithm>
-#include <fnmatch.h>
-#include <dirent.h>
+#include <cmath>
+#include <cstring>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <sys/stat.h>
 
 namespace duckdb {
 
-// Helper function to expand glob patterns
-static vector<string> ExpandGlobPattern(const string &pattern) {
-	vector<string> files;
-
-	// Check if pattern contains wildcards
-	if (pattern.find('*') == string::npos && pattern.find('?') == string::npos && pattern.find('[') == string::npos) {
-		// No wildcards, just return the single file
-		files.push_back(pattern);
-		return files;
-	}
-
-	// Extract directory and filename pattern
-	size_t last_slash = pattern.find_last_of('/');
-	string dir_path;
-	string filename_pattern;
-
-	if (last_slash != string::npos) {
-		dir_path = pattern.substr(0, last_slash);
-		filename_pattern = pattern.substr(last_slash + 1);
-	} else {
-		dir_path = ".";
-		filename_pattern = pattern;
-	}
-
-	// Open directory
-	DIR *dir = opendir(dir_path.c_str());
-	if (!dir) {
-		return files; // Return empty vector if directory doesn't exist
-	}
-
-	// Read directory entries
-	struct dirent *entry;
-	while ((entry = readdir(dir)) != nullptr) {
-		// Skip . and .. entries
-		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
-			continue;
-		}
-
-		// Check if it matches the pattern
-		if (fnmatch(filename_pattern.c_str(), entry->d_name, 0) == 0) {
-			// Construct full path
-			string full_path;
-			if (dir_path == ".") {
-				full_path = entry->d_name;
-			} else {
-				full_path = dir_path + "/" + entry->d_name;
-			}
-
-			// Check if it's a regular file
-			struct stat statbuf;
-			if (stat(full_path.c_str(), &statbuf) == 0 && S_ISREG(statbuf.st_mode)) {
-				files.push_back(full_path);
-			}
-		}
-	}
-
-	closedir(dir);
-
-	// Sort files for consistent ordering
-	std::sort(files.begin(), files.end());
-
-	return files;
-}
-
-// Structure to hold FIT record data - aligned with documentation
-struct FitRecord {
-	// Basic timestamp and location
-	timestamp_tz_t timestamp;
-	double latitude;          // Converted from semicircles to degrees
-	double longitude;         // Converted from semicircles to degrees
-	double altitude;          // Meters
-	double enhanced_altitude; // Meters (higher precision)
-
-	// Speed and distance
-	double distance;       // Meters (cumulative)
-	double speed;          // Meters per second
-	double enhanced_speed; // Meters per second (higher precision)
-	double vertical_speed; // Meters per second
-
-	// Power metrics (watts)
-	uint16_t power;
-	uint16_t motor_power; // E-bike motor power
-	uint32_t accumulated_power;
-	uint16_t compressed_accumulated_power;
-
-	// Heart rate and physiological data
-	uint8_t heart_rate; // Beats per minute (corrected from uint16_t)
-	double total_hemoglobin_conc;
-	double total_hemoglobin_conc_min;
-	double total_hemoglobin_conc_max;
-	double saturated_hemoglobin_percent;
-	double saturated_hemoglobin_percent_min;
-	double saturated_hemoglobin_percent_max;
-
-	// Cadence metrics
-	uint8_t cadence; // RPM/steps per minute (corrected from uint16_t)
-	double cadence256;
-	double fractional_cadence;
-
-	// Temperature (Celsius)
-	int8_t temperature; // Corrected to int8_t for proper range
-	double core_temperature;
-
-	// Cycling metrics
-	double grade; // Percentage
-	uint16_t resistance;
-	uint8_t left_right_balance;        // Percentage (corrected from double)
-	double left_torque_effectiveness;  // Percentage
-	double right_torque_effectiveness; // Percentage
-	double left_pedal_smoothness;      // Percentage
-	double right_pedal_smoothness;     // Percentage
-	double combined_pedal_smoothness;  // Percentage
-	int8_t left_pco;                   // Platform center offset (mm)
-	int8_t right_pco;                  // Platform center offset (mm)
-
-	// Running metrics
-	double vertical_oscillation; // Millimeters
-	double stance_time_percent;  // Percentage
-	double stance_time;          // Milliseconds
-	double stance_time_balance;
-	double step_length;    // Millimeters
-	double vertical_ratio; // Percentage
-
-	// Cycling/Swimming specific
-	double cycle_length; // Meters
-	double cycle_length16;
-	uint8_t cycles;
-	uint32_t total_cycles;
-
-	// Navigation and course
-	double time_from_course; // Seconds
-	uint8_t gps_accuracy;    // Meters
-
-	// Energy and calories
-	uint16_t calories; // Kilocalories
-
-	// Zones and training
-	uint8_t zone;
-	string activity_type;
-	string stroke_type;
-
-	// Advanced metrics
-	double time128;
-	double grit;
-	double flow;
-	double current_stress;
-
-	// E-bike specific
-	uint16_t ebike_travel_range;
-	uint8_t ebike_battery_level;
-	uint8_t ebike_assist_mode;
-	uint8_t ebike_assist_level_percent;
-	double battery_soc; // Percentage
-
-	// Sports specific
-	double ball_speed; // Meters per second
-
-	// Diving/Swimming specific
-	uint32_t absolute_pressure;  // Pascals
-	double depth;                // Meters
-	double next_stop_depth;      // Meters
-	uint32_t next_stop_time;     // Seconds
-	uint32_t time_to_surface;    // Seconds
-	uint32_t ndl_time;           // Seconds (No Decompression Limit)
-	uint8_t cns_load;            // Percentage
-	uint16_t n2_load;            // Percentage
-	uint32_t air_time_remaining; // Seconds
-	double pressure_sac;         // Pressure Surface Air Consumption
-	double volume_sac;           // Volume Surface Air Consumption
-	double rmv;                  // Respiratory Minute Volume
-	double ascent_rate;          // Meters per second
-	double po2;                  // Partial pressure O2
-
-	// Respiratory
-	uint8_t respiration_rate; // Breaths per minute
-	double enhanced_respiration_rate;
-
-	// Device info
-	uint8_t device_index;
-
-	// File source information
-	string file_source;
-
-	// Initialize all fields to invalid/zero values
-	FitRecord()
-	    : timestamp(timestamp_tz_t()), latitude(0.0), longitude(0.0), altitude(0.0), enhanced_altitude(0.0),
-	      distance(0.0), speed(0.0), enhanced_speed(0.0), vertical_speed(0.0), power(0), motor_power(0),
-	      accumulated_power(0), compressed_accumulated_power(0), heart_rate(0), total_hemoglobin_conc(0.0),
-	      total_hemoglobin_conc_min(0.0), total_hemoglobin_conc_max(0.0), saturated_hemoglobin_percent(0.0),
-	      saturated_hemoglobin_percent_min(0.0), saturated_hemoglobin_percent_max(0.0), cadence(0), cadence256(0.0),
-	      fractional_cadence(0.0), temperature(0), core_temperature(0.0), grade(0.0), resistance(0),
-	      left_right_balance(0), left_torque_effectiveness(0.0), right_torque_effectiveness(0.0),
-	      left_pedal_smoothness(0.0), right_pedal_smoothness(0.0), combined_pedal_smoothness(0.0), left_pco(0),
-	      right_pco(0), vertical_oscillation(0.0), stance_time_percent(0.0), stance_time(0.0), stance_time_balance(0.0),
-	      step_length(0.0), vertical_ratio(0.0), cycle_length(0.0), cycle_length16(0.0), cycles(0), total_cycles(0),
-	      time_from_course(0.0), gps_accuracy(0), calories(0), zone(0), activity_type(""), stroke_type(""),
-	      time128(0.0), grit(0.0), flow(0.0), current_stress(0.0), ebike_travel_range(0), ebike_battery_level(0),
-	      ebike_assist_mode(0), ebike_assist_level_percent(0), battery_soc(0.0), ball_speed(0.0), absolute_pressure(0),
-	      depth(0.0), next_stop_depth(0.0), next_stop_time(0), time_to_surface(0), ndl_time(0), cns_load(0), n2_load(0),
-	      air_time_remaining(0), pressure_sac(0.0), volume_sac(0.0), rmv(0.0), ascent_rate(0.0), po2(0.0),
-	      respiration_rate(0), enhanced_respiration_rate(0.0), device_index(0), file_source("") {
-	}
-};
-
 // Structure to hold FIT activity metadata
 struct FitActivity {
 	uint64_t activity_id;
@@ -467,317 +290,722 @@ struct FitUser {
 	}
 };
 
-// FIT message listener to collect all types of data
-class FitDataCollector : public fit::RecordMesgListener,
-                         public fit::FileIdMesgListener,
-                         public fit::ActivityMesgListener,
-                         public fit::SessionMesgListener,
-                         public fit::LapMesgListener,
-                         public fit::DeviceInfoMesgListener,
-                         public fit::EventMesgListener,
-                         public fit::UserProfileMesgListener {
-public:
-	std::vector<FitRecord> records;
-	std::vector<FitActivity> activities;
-	std::vector<FitSession> sessions;
-	std::vector<FitLap> laps;
-	std::vector<FitDevice> devices;
-	std::vector<FitEvent> events;
-	std::vector<FitUser> users;
-	string file_type;
-	string manufacturer;
-	string activity_name;
-	string current_activity_type; // Track current activity type for records
-	string current_file_source;   // Track current file being processed
+// Where the values of a fit_records column come from
+enum class FitRecordSource : uint8_t {
+	FIELD,         // a record message field
+	ACTIVITY_TYPE, // the sport of the file's session
+	FILE_SOURCE,   // the path of the file
+	NONE           // not decoded, NULL for every row
+};
 
-	FitDataCollector() : current_activity_type(""), current_file_source("") {
-	}
+// Physical type a column is stored and emitted as
+template <LogicalTypeId TYPE>
+struct FitPhysicalType;
+template <>
+struct FitPhysicalType<LogicalTypeId::TINYINT> {
+	typedef int8_t type;
+};
+template <>
+struct FitPhysicalType<LogicalTypeId::UTINYINT> {
+	typedef uint8_t type;
+};
+template <>
+struct FitPhysicalType<LogicalTypeId::USMALLINT> {
+	typedef uint16_t type;
+};
+template <>
+struct FitPhysicalType<LogicalTypeId::UINTEGER> {
+	typedef uint32_t type;
+};
+template <>
+struct FitPhysicalType<LogicalTypeId::DOUBLE> {
+	typedef double type;
+};
+template <>
+struct FitPhysicalType<LogicalTypeId::TIMESTAMP_TZ> {
+	typedef timestamp_tz_t type;
+};
 
-	// Method to set the current file being processed
-	void SetCurrentFile(const string &file_path) {
-		current_file_source = file_path;
+template <class T>
+static void StoreFitRecordValue(data_ptr_t target, double value) {
+	T converted = (T)value;
+	memcpy(target, &converted, sizeof(T));
+}
+
+static void StoreFitSemicircles(data_ptr_t target, double value) {
+	StoreFitRecordValue<double>(target, value * (180.0 / 2147483648.0));
+}
+
+static void StoreFitTimestamp(data_ptr_t target, double value) {
+	// FIT epoch: 1989-12-31 00:00:00 UTC = 631065600 seconds since Unix epoch (1970-01-01)
+	timestamp_tz_t timestamp(Timestamp::FromEpochSeconds((int64_t)value + 631065600));
+	memcpy(target, &timestamp, sizeof(timestamp));
+}
+
+// Column of fit_records. Field values arrive scaled by the profile (e.g. meters for altitude)
+// from FitFieldExtractor and are stored in the physical type of the column. A value is NULL only
+// when the field is missing from the message or holds the FIT invalid value of its base type, so
+// zeros (0 W, 0 m, 0 C) are kept.
+struct FitRecordColumn {
+	const char *name;
+	LogicalTypeId type;
+	FitRecordSource source;
+	// Record field of a FIELD column, the width it is stored with and its conversion
+	FIT_UINT8 field_num;
+	idx_t width;
+	void (*store)(data_ptr_t target, double value);
+};
+
+#define FIT_RECORD_FIELD_AS(NAME, TYPE, FIELD_DEF, STORE)                                                              \
+	{                                                                                                                  \
+		#NAME, LogicalTypeId::TYPE, FitRecordSource::FIELD, fit::RecordMesg::FieldDefNum::FIELD_DEF,                   \
+		    sizeof(FitPhysicalType<LogicalTypeId::TYPE>::type), STORE                                                  \
 	}
+#define FIT_RECORD_FIELD(NAME, TYPE, FIELD_DEF)                                                                        \
+	FIT_RECORD_FIELD_AS(NAME, TYPE, FIELD_DEF, StoreFitRecordValue<FitPhysicalType<LogicalTypeId::TYPE>::type>)
+#define FIT_RECORD_COLUMN(NAME, TYPE, SOURCE)                                                                          \
+	{ #NAME, LogicalTypeId::TYPE, FitRecordSource::SOURCE, FIT_FIELD_NUM_INVALID, 0, nullptr }
+
+static const FitRecordColumn FIT_RECORD_COLUMNS[] = {
+    // Basic timestamp and location
+    FIT_RECORD_FIELD_AS(timestamp, TIMESTAMP_TZ, Timestamp, StoreFitTimestamp),
+    FIT_RECORD_FIELD_AS(latitude, DOUBLE, PositionLat, StoreFitSemicircles),
+    FIT_RECORD_FIELD_AS(longitude, DOUBLE, PositionLong, StoreFitSemicircles),
+    FIT_RECORD_FIELD(altitude, DOUBLE, Altitude),
+    FIT_RECORD_FIELD(enhanced_altitude, DOUBLE, EnhancedAltitude),
+
+    // Speed and distance
+    FIT_RECORD_FIELD(distance, DOUBLE, Distance),
+    FIT_RECORD_FIELD(speed, DOUBLE, Speed),
+    FIT_RECORD_FIELD(enhanced_speed, DOUBLE, EnhancedSpeed),
+    FIT_RECORD_FIELD(vertical_speed, DOUBLE, VerticalSpeed),
+
+    // Power metrics
+    FIT_RECORD_FIELD(power, USMALLINT, Power),
+    FIT_RECORD_FIELD(motor_power, USMALLINT, MotorPower),
+    FIT_RECORD_FIELD(accumulated_power, UINTEGER, AccumulatedPower),
+    FIT_RECORD_FIELD(compressed_accumulated_power, USMALLINT, CompressedAccumulatedPower),
+
+    // Heart rate and physiological data
+    FIT_RECORD_FIELD(heart_rate, UTINYINT, HeartRate),
+    FIT_RECORD_FIELD(total_hemoglobin_conc, DOUBLE, TotalHemoglobinConc),
+    FIT_RECORD_FIELD(total_hemoglobin_conc_min, DOUBLE, TotalHemoglobinConcMin),
+    FIT_RECORD_FIELD(total_hemoglobin_conc_max, DOUBLE, TotalHemoglobinConcMax),
+    FIT_RECORD_FIELD(saturated_hemoglobin_percent, DOUBLE, SaturatedHemoglobinPercent),
+    FIT_RECORD_FIELD(saturated_hemoglobin_percent_min, DOUBLE, SaturatedHemoglobinPercentMin),
+    FIT_RECORD_FIELD(saturated_hemoglobin_percent_max, DOUBLE, SaturatedHemoglobinPercentMax),
+
+    // Cadence metrics
+    FIT_RECORD_FIELD(cadence, UTINYINT, Cadence),
+    FIT_RECORD_FIELD(cadence256, DOUBLE, Cadence256),
+    FIT_RECORD_FIELD(fractional_cadence, DOUBLE, FractionalCadence),
+
+    // Temperature
+    FIT_RECORD_FIELD(temperature, TINYINT, Temperature),
+    FIT_RECORD_FIELD(core_temperature, DOUBLE, CoreTemperature),
+
+    // Cycling metrics
+    FIT_RECORD_FIELD(grade, DOUBLE, Grade),
+    FIT_RECORD_FIELD(resistance, USMALLINT, Resistance),
+    FIT_RECORD_FIELD(left_right_balance, UTINYINT, LeftRightBalance),
+    FIT_RECORD_FIELD(left_torque_effectiveness, DOUBLE, LeftTorqueEffectiveness),
+    FIT_RECORD_FIELD(right_torque_effectiveness, DOUBLE, RightTorqueEffectiveness),
+    FIT_RECORD_FIELD(left_pedal_smoothness, DOUBLE, LeftPedalSmoothness),
+    FIT_RECORD_FIELD(right_pedal_smoothness, DOUBLE, RightPedalSmoothness),
+    FIT_RECORD_FIELD(combined_pedal_smoothness, DOUBLE, CombinedPedalSmoothness),
+    FIT_RECORD_FIELD(left_pco, TINYINT, LeftPco),
+    FIT_RECORD_FIELD(right_pco, TINYINT, RightPco),
+
+    // Running metrics
+    FIT_RECORD_FIELD(vertical_oscillation, DOUBLE, VerticalOscillation),
+    FIT_RECORD_FIELD(stance_time_percent, DOUBLE, StanceTimePercent),
+    FIT_RECORD_FIELD(stance_time, DOUBLE, StanceTime),
+    FIT_RECORD_FIELD(stance_time_balance, DOUBLE, StanceTimeBalance),
+    FIT_RECORD_FIELD(step_length, DOUBLE, StepLength),
+    FIT_RECORD_FIELD(vertical_ratio, DOUBLE, VerticalRatio),
+
+    // Cycling/Swimming specific
+    FIT_RECORD_COLUMN(cycle_length, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(cycle_length16, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(cycles, UTINYINT, NONE),
+    FIT_RECORD_COLUMN(total_cycles, UINTEGER, NONE),
+
+    // Navigation and course
+    FIT_RECORD_COLUMN(time_from_course, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(gps_accuracy, UTINYINT, NONE),
+
+    // Energy and calories
+    FIT_RECORD_COLUMN(calories, USMALLINT, NONE),
+
+    // Zones and training
+    FIT_RECORD_COLUMN(zone, UTINYINT, NONE),
+    FIT_RECORD_COLUMN(activity_type, VARCHAR, ACTIVITY_TYPE),
+    FIT_RECORD_COLUMN(stroke_type, VARCHAR, NONE),
+
+    // Advanced metrics
+    FIT_RECORD_COLUMN(time128, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(grit, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(flow, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(current_stress, DOUBLE, NONE),
+
+    // E-bike specific
+    FIT_RECORD_COLUMN(ebike_travel_range, USMALLINT, NONE),
+    FIT_RECORD_COLUMN(ebike_battery_level, UTINYINT, NONE),
+    FIT_RECORD_COLUMN(ebike_assist_mode, UTINYINT, NONE),
+    FIT_RECORD_COLUMN(ebike_assist_level_percent, UTINYINT, NONE),
+    FIT_RECORD_COLUMN(battery_soc, DOUBLE, NONE),
+
+    // Sports specific
+    FIT_RECORD_COLUMN(ball_speed, DOUBLE, NONE),
+
+    // Diving/Swimming specific
+    FIT_RECORD_COLUMN(absolute_pressure, UINTEGER, NONE),
+    FIT_RECORD_COLUMN(depth, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(next_stop_depth, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(next_stop_time, UINTEGER, NONE),
+    FIT_RECORD_COLUMN(time_to_surface, UINTEGER, NONE),
+    FIT_RECORD_COLUMN(ndl_time, UINTEGER, NONE),
+    FIT_RECORD_COLUMN(cns_load, UTINYINT, NONE),
+    FIT_RECORD_COLUMN(n2_load, USMALLINT, NONE),
+    FIT_RECORD_COLUMN(air_time_remaining, UINTEGER, NONE),
+    FIT_RECORD_COLUMN(pressure_sac, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(volume_sac, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(rmv, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(ascent_rate, DOUBLE, NONE),
+    FIT_RECORD_COLUMN(po2, DOUBLE, NONE),
+
+    // Respiratory
+    FIT_RECORD_COLUMN(respiration_rate, UTINYINT, NONE),
+    FIT_RECORD_COLUMN(enhanced_respiration_rate, DOUBLE, NONE),
+
+    // Device info
+    FIT_RECORD_COLUMN(device_index, UTINYINT, NONE),
+
+    // File source
+    FIT_RECORD_COLUMN(file_source, VARCHAR, FILE_SOURCE),
+};
 
-	void OnMesg(fit::RecordMesg &record) override {
-		FitRecord fitRecord = {};
-
-		// Timestamp
-		if (record.IsTimestampValid()) {
-			// Convert FIT timestamp (seconds since 1989-12-31 UTC) to DuckDB timestamp with timezone
-			// FIT epoch: 1989-12-31 00:00:00 UTC = 631065600 seconds since Unix epoch (1970-01-01)
-			uint32_t fit_timestamp = record.GetTimestamp();
-			int64_t unix_timestamp = fit_timestamp + 631065600; // Convert to Unix timestamp
-			timestamp_t ts = Timestamp::FromEpochSeconds(unix_timestamp);
-			timestamp_tz_t ts_with_tz = timestamp_tz_t(ts);
-			fitRecord.timestamp = ts_with_tz;
-		}
+static constexpr idx_t FIT_RECORD_COLUMN_COUNT = sizeof(FIT_RECORD_COLUMNS) / sizeof(FIT_RECORD_COLUMNS[0]);
 
-		// Position - Convert semicircles to degrees properly
-		if (record.IsPositionLatValid()) {
-			int32_t lat_semicircles = record.GetPositionLat();
-			if (lat_semicircles != 0x7FFFFFFF) { // Check for invalid value
-				fitRecord.latitude = lat_semicircles * (180.0 / 2147483648.0);
-			}
-		}
-		if (record.IsPositionLongValid()) {
-			int32_t long_semicircles = record.GetPositionLong();
-			if (long_semicircles != 0x7FFFFFFF) { // Check for invalid value
-				fitRecord.longitude = long_semicircles * (180.0 / 2147483648.0);
-			}
+// Record columns decoded from a field among the given fit_records columns
+static vector<const FitRecordColumn *> FitRecordFields(const vector<string> &columns) {
+	vector<const FitRecordColumn *> fields;
+	for (auto &column : FIT_RECORD_COLUMNS) {
+		if (column.source == FitRecordSource::FIELD &&
+		    std::find(columns.begin(), columns.end(), column.name) != columns.end()) {
+			fields.push_back(&column);
 		}
+	}
+	return fields;
+}
 
-		// Altitude
-		if (record.IsAltitudeValid()) {
-			uint16_t alt = record.GetAltitude();
-			if (alt != 0xFFFF) {                          // Check for invalid value
-				fitRecord.altitude = (alt / 5.0) - 500.0; // Convert from scaled value
-			}
-		}
-		if (record.IsEnhancedAltitudeValid()) {
-			uint32_t enh_alt = record.GetEnhancedAltitude();
-			if (enh_alt != 0xFFFFFFFF) {                               // Check for invalid value
-				fitRecord.enhanced_altitude = (enh_alt / 5.0) - 500.0; // Convert from scaled value
-			}
-		}
+static vector<FIT_UINT8> FitRecordFieldNums(const vector<const FitRecordColumn *> &fields) {
+	vector<FIT_UINT8> field_nums;
+	for (auto field : fields) {
+		field_nums.push_back(field->field_num);
+	}
+	return field_nums;
+}
 
-		// Speed and distance
-		if (record.IsDistanceValid()) {
-			uint32_t dist = record.GetDistance();
-			if (dist != 0xFFFFFFFF) {              // Check for invalid value
-				fitRecord.distance = dist / 100.0; // Convert from scaled value (cm to m)
-			}
-		}
-		if (record.IsSpeedValid()) {
-			uint16_t spd = record.GetSpeed();
-			if (spd != 0xFFFF) {                // Check for invalid value
-				fitRecord.speed = spd / 1000.0; // Convert from scaled value (mm/s to m/s)
-			}
+template <class T>
+static double LoadFitRecordValue(const_data_ptr_t data) {
+	T value;
+	memcpy(&value, data, sizeof(T));
+	return (double)value;
+}
+
+// Stored value of a record field column as a double, microseconds for the timestamp
+static double LoadFitRecordColumnValue(const FitRecordColumn &column, const_data_ptr_t data) {
+	switch (column.type) {
+	case LogicalTypeId::TINYINT:
+		return LoadFitRecordValue<int8_t>(data);
+	case LogicalTypeId::UTINYINT:
+		return LoadFitRecordValue<uint8_t>(data);
+	case LogicalTypeId::USMALLINT:
+		return LoadFitRecordValue<uint16_t>(data);
+	case LogicalTypeId::UINTEGER:
+		return LoadFitRecordValue<uint32_t>(data);
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return LoadFitRecordValue<int64_t>(data);
+	default:
+		return LoadFitRecordValue<double>(data);
+	}
+}
+
+// Value a raw record field value is emitted as, after the scale and offset of the field and the
+// conversion of its column
+static double GetFitRecordOutputValue(const FitRecordColumn &column, const fit::Profile::FIELD &field, double raw) {
+	data_t stored[sizeof(double)];
+	column.store(stored, raw / field.scale - field.offset);
+	return LoadFitRecordColumnValue(column, stored);
+}
+
+// Output value of a record field column as a DuckDB value
+static Value GetFitRecordColumnValue(const FitRecordColumn &column, double value) {
+	switch (column.type) {
+	case LogicalTypeId::TINYINT:
+		return Value::TINYINT((int8_t)value);
+	case LogicalTypeId::UTINYINT:
+		return Value::UTINYINT((uint8_t)value);
+	case LogicalTypeId::USMALLINT:
+		return Value::USMALLINT((uint16_t)value);
+	case LogicalTypeId::UINTEGER:
+		return Value::UINTEGER((uint32_t)value);
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return Value::TIMESTAMPTZ(timestamp_tz_t((int64_t)value));
+	default:
+		return Value::DOUBLE(value);
+	}
+}
+
+static vector<idx_t> FitRecordFieldWidths(const vector<const FitRecordColumn *> &fields) {
+	vector<idx_t> widths;
+	for (auto field : fields) {
+		widths.push_back(field->width);
+	}
+	return widths;
+}
+
+// Record timestamps a scan keeps, in FIT seconds (since 1989-12-31 UTC) with both bounds included.
+// Narrowed by the filters on the timestamp column of fit_records.
+struct FitTimestampRange {
+	int64_t min = NumericLimits<int64_t>::Minimum();
+	int64_t max = NumericLimits<int64_t>::Maximum();
+
+	bool IsSet() const {
+		return min != NumericLimits<int64_t>::Minimum() || max != NumericLimits<int64_t>::Maximum();
+	}
+
+	bool Overlaps(int64_t first, int64_t last) const {
+		return first <= max && last >= min;
+	}
+};
+
+// Raw values of a record field kept by the filters of a scan, before scale and offset. Records are
+// dropped by the field extractor before they are converted.
+struct FitRecordFilter {
+	const FitRecordColumn *column;
+	double raw_min;
+	double raw_max;
+};
+
+// Timestamps of the earliest and latest record of a file in FIT seconds, known once it was decoded.
+// Devices write records before their clock is set and correct it mid-file, so the records are
+// only known to be in time order when no record was older than the one before it.
+struct FitRecordSpan {
+	bool has_records;
+	int64_t first;
+	int64_t last;
+	bool ordered;
+};
+
+// FIT table functions, in the order of the row counts of FitFileStatistics
+static const char *const FIT_TABLE_TYPES[] = {"records", "activities", "sessions", "laps",
+                                               "devices", "events",     "users"};
+static constexpr idx_t FIT_TABLE_COUNT = sizeof(FIT_TABLE_TYPES) / sizeof(FIT_TABLE_TYPES[0]);
+
+static idx_t GetFitTableIndex(const string &table_type) {
+	for (idx_t i = 0; i < FIT_TABLE_COUNT; i++) {
+		if (table_type == FIT_TABLE_TYPES[i]) {
+			return i;
 		}
-		if (record.IsEnhancedSpeedValid()) {
-			uint32_t enh_spd = record.GetEnhancedSpeed();
-			if (enh_spd != 0xFFFFFFFF) {                     // Check for invalid value
-				fitRecord.enhanced_speed = enh_spd / 1000.0; // Convert from scaled value
-			}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+// fit_records columns with min/max statistics for the optimizer, the timestamp and the major metrics
+static const char *const FIT_RECORD_STATISTICS_COLUMNS[] = {"timestamp", "distance", "speed",     "altitude",
+                                                             "power",     "heart_rate", "cadence"};
+static constexpr idx_t FIT_RECORD_STATISTICS_COUNT =
+    sizeof(FIT_RECORD_STATISTICS_COLUMNS) / sizeof(FIT_RECORD_STATISTICS_COLUMNS[0]);
+
+static idx_t GetFitRecordStatisticsIndex(const FitRecordColumn &column) {
+	for (idx_t i = 0; i < FIT_RECORD_STATISTICS_COUNT; i++) {
+		if (strcmp(column.name, FIT_RECORD_STATISTICS_COLUMNS[i]) == 0) {
+			return i;
 		}
-		if (record.IsVerticalSpeedValid()) {
-			int16_t vert_spd = record.GetVerticalSpeed();
-			if (vert_spd != 0x7FFF) {                         // Check for invalid value
-				fitRecord.vertical_speed = vert_spd / 1000.0; // Convert from scaled value
-			}
+	}
+	return DConstants::INVALID_INDEX;
+}
+
+// Smallest and largest output value of a record column over the records that have one
+struct FitValueRange {
+	bool known;      // False if the column was not decoded
+	bool has_values; // False if no record has a value
+	double min;
+	double max;
+
+	void Merge(const FitValueRange &other) {
+		if (!other.has_values) {
+			return;
 		}
+		min = has_values ? MinValue(min, other.min) : other.min;
+		max = has_values ? MaxValue(max, other.max) : other.max;
+		has_values = true;
+	}
+};
 
-		// Power metrics
-		if (record.IsPowerValid()) {
-			uint16_t pwr = record.GetPower();
-			if (pwr != 0xFFFF) { // Check for invalid value
-				fitRecord.power = pwr;
-			}
+// Row counts and record value ranges of a decoded file, remembered by the process so that later
+// scans are estimated and described to the optimizer without decoding the file
+struct FitFileStatistics {
+	// Rows of every table, INVALID_INDEX for the tables the file was not decoded for
+	idx_t rows[FIT_TABLE_COUNT];
+	FitValueRange values[FIT_RECORD_STATISTICS_COUNT];
+
+	FitFileStatistics() {
+		for (auto &table_rows : rows) {
+			table_rows = DConstants::INVALID_INDEX;
 		}
-		if (record.IsMotorPowerValid()) {
-			uint16_t motor_pwr = record.GetMotorPower();
-			if (motor_pwr != 0xFFFF) { // Check for invalid value
-				fitRecord.motor_power = motor_pwr;
-			}
+		for (auto &range : values) {
+			range = {false, false, 0, 0};
 		}
-		if (record.IsAccumulatedPowerValid()) {
-			uint32_t acc_pwr = record.GetAccumulatedPower();
-			if (acc_pwr != 0xFFFFFFFF) { // Check for invalid value
-				fitRecord.accumulated_power = acc_pwr;
+	}
+
+	// Takes what another decode of the same file knows
+	void Merge(const FitFileStatistics &other) {
+		for (idx_t i = 0; i < FIT_TABLE_COUNT; i++) {
+			if (other.rows[i] != DConstants::INVALID_INDEX) {
+				rows[i] = other.rows[i];
 			}
 		}
-		if (record.IsCompressedAccumulatedPowerValid()) {
-			uint16_t comp_acc_pwr = record.GetCompressedAccumulatedPower();
-			if (comp_acc_pwr != 0xFFFF) { // Check for invalid value
-				fitRecord.compressed_accumulated_power = comp_acc_pwr;
+		for (idx_t i = 0; i < FIT_RECORD_STATISTICS_COUNT; i++) {
+			if (other.values[i].known) {
+				values[i] = other.values[i];
 			}
 		}
+	}
 
-		// Heart rate and physiological
-		if (record.IsHeartRateValid()) {
-			uint8_t hr = record.GetHeartRate();
-			if (hr != 0xFF) { // Check for invalid value
-				fitRecord.heart_rate = hr;
-			}
-		}
-		if (record.IsTotalHemoglobinConcValid()) {
-			uint16_t thc = record.GetTotalHemoglobinConc();
-			if (thc != 0xFFFF) {                               // Check for invalid value
-				fitRecord.total_hemoglobin_conc = thc / 100.0; // Convert from scaled value
+	bool IsComplete() const {
+		for (idx_t i = 0; i < FIT_TABLE_COUNT; i++) {
+			if (rows[i] == DConstants::INVALID_INDEX) {
+				return false;
 			}
 		}
-		if (record.IsTotalHemoglobinConcMinValid()) {
-			uint16_t thc_min = record.GetTotalHemoglobinConcMin();
-			if (thc_min != 0xFFFF) { // Check for invalid value
-				fitRecord.total_hemoglobin_conc_min = thc_min / 100.0;
+		for (idx_t i = 0; i < FIT_RECORD_STATISTICS_COUNT; i++) {
+			if (!values[i].known) {
+				return false;
 			}
 		}
-		if (record.IsTotalHemoglobinConcMaxValid()) {
-			uint16_t thc_max = record.GetTotalHemoglobinConcMax();
-			if (thc_max != 0xFFFF) { // Check for invalid value
-				fitRecord.total_hemoglobin_conc_max = thc_max / 100.0;
+		return true;
+	}
+};
+
+// Adds the fields with components that expand into one of the fields, until none is added, so
+// that nested components (compressed_speed_distance to speed to enhanced_speed) are expanded
+// all the way down to the fields read
+static void AddFitComponentSources(FIT_UINT16 mesg_num, std::unordered_set<FIT_UINT8> &field_nums) {
+	auto mesg = fit::Profile::GetMesg(mesg_num);
+	if (!mesg) {
+		return;
+	}
+	auto expands = [&](const fit::Profile::FIELD_COMPONENT *components, FIT_UINT16 count) {
+		for (FIT_UINT16 i = 0; i < count; i++) {
+			if (field_nums.count(components[i].num)) {
+				return true;
 			}
 		}
-		if (record.IsSaturatedHemoglobinPercentValid()) {
-			uint16_t shp = record.GetSaturatedHemoglobinPercent();
-			if (shp != 0xFFFF) {                                     // Check for invalid value
-				fitRecord.saturated_hemoglobin_percent = shp / 10.0; // Convert from scaled value
+		return false;
+	};
+	bool added = true;
+	while (added) {
+		added = false;
+		for (FIT_UINT16 i = 0; i < mesg->numFields; i++) {
+			auto &field = mesg->fields[i];
+			if (field_nums.count(field.num)) {
+				continue;
 			}
-		}
-		if (record.IsSaturatedHemoglobinPercentMinValid()) {
-			uint16_t shp_min = record.GetSaturatedHemoglobinPercentMin();
-			if (shp_min != 0xFFFF) { // Check for invalid value
-				fitRecord.saturated_hemoglobin_percent_min = shp_min / 10.0;
+			bool source = expands(field.components, field.numComponents);
+			for (FIT_UINT16 j = 0; !source && j < field.numSubFields; j++) {
+				source = expands(field.subFields[j].components, field.subFields[j].numComponents);
 			}
-		}
-		if (record.IsSaturatedHemoglobinPercentMaxValid()) {
-			uint16_t shp_max = record.GetSaturatedHemoglobinPercentMax();
-			if (shp_max != 0xFFFF) { // Check for invalid value
-				fitRecord.saturated_hemoglobin_percent_max = shp_max / 10.0;
+			if (source) {
+				field_nums.insert(field.num);
+				added = true;
 			}
 		}
+	}
+}
 
-		// Cadence
-		if (record.IsCadenceValid()) {
-			uint8_t cad = record.GetCadence();
-			if (cad != 0xFF) { // Check for invalid value
-				fitRecord.cadence = cad;
-			}
-		}
-		if (record.IsCadence256Valid()) {
-			uint16_t cad256 = record.GetCadence256();
-			if (cad256 != 0xFFFF) {                    // Check for invalid value
-				fitRecord.cadence256 = cad256 / 256.0; // Convert from scaled value
-			}
-		}
-		if (record.IsFractionalCadenceValid()) {
-			uint8_t frac_cad = record.GetFractionalCadence();
-			if (frac_cad != 0xFF) {                              // Check for invalid value
-				fitRecord.fractional_cadence = frac_cad / 128.0; // Convert from scaled value
+// Message families decoded from a file. Record fields are extracted per column, every other
+// family is collected as a whole.
+struct FitDecodePlan {
+	bool records = false;
+	bool file_ids = false;
+	bool activities = false;
+	bool sessions = false;
+	bool laps = false;
+	bool devices = false;
+	bool events = false;
+	bool users = false;
+	vector<const FitRecordColumn *> record_fields;
+	// Verify the file CRC even when the scan does not, the result is shared with scans that do
+	bool check_crc = false;
+	// Records outside of the range are dropped
+	FitTimestampRange timestamp_range;
+	// Records with a field outside of its raw range are dropped
+	vector<FitRecordFilter> record_filters;
+	// Decoding may stop at the first record past the range of a file known to be in time order.
+	// The messages that follow the records (sessions) are not read then.
+	bool stop_after_range = false;
+	// Expand the components of fields into the fields the collector reads (e.g. enhanced_speed from
+	// speed), otherwise only the fields present in the messages are read
+	bool expand_components = true;
+
+	// Everything any FIT table function reads, the plan of files shared through the file cache
+	static FitDecodePlan All() {
+		FitDecodePlan plan;
+		plan.records = plan.file_ids = plan.activities = plan.sessions = true;
+		plan.laps = plan.devices = plan.events = plan.users = true;
+		for (auto &column : FIT_RECORD_COLUMNS) {
+			if (column.source == FitRecordSource::FIELD) {
+				plan.record_fields.push_back(&column);
 			}
 		}
+		plan.check_crc = true;
+		return plan;
+	}
 
-		// Temperature
-		if (record.IsTemperatureValid()) {
-			int8_t temp = record.GetTemperature();
-			if (temp != 0x7F) {               // Check for invalid value
-				fitRecord.temperature = temp; // Already in Celsius
-			}
-		}
-		if (record.IsCoreTemperatureValid()) {
-			uint16_t core_temp = record.GetCoreTemperature();
-			if (core_temp != 0xFFFF) {                          // Check for invalid value
-				fitRecord.core_temperature = core_temp / 100.0; // Convert from scaled value
+	// Global message numbers of the families of the plan, the decoder skips every other message
+	std::unordered_set<FIT_UINT16> MesgNums() const {
+		std::unordered_set<FIT_UINT16> mesg_nums;
+		const std::pair<bool, FIT_UINT16> families[] = {
+		    {records, FIT_MESG_NUM_RECORD},   {file_ids, FIT_MESG_NUM_FILE_ID}, {activities, FIT_MESG_NUM_ACTIVITY},
+		    {sessions, FIT_MESG_NUM_SESSION}, {laps, FIT_MESG_NUM_LAP},         {devices, FIT_MESG_NUM_DEVICE_INFO},
+		    {events, FIT_MESG_NUM_EVENT},     {users, FIT_MESG_NUM_USER_PROFILE}};
+		for (auto &family : families) {
+			if (family.first) {
+				mesg_nums.insert(family.second);
 			}
 		}
+		return mesg_nums;
+	}
 
-		// Cycling metrics
-		if (record.IsGradeValid()) {
-			int16_t grd = record.GetGrade();
-			if (grd != 0x7FFF) {               // Check for invalid value
-				fitRecord.grade = grd / 100.0; // Convert from scaled value (percentage)
-			}
-		}
-		if (record.IsResistanceValid()) {
-			uint8_t res = record.GetResistance();
-			if (res != 0xFF) { // Check for invalid value
-				fitRecord.resistance = res;
-			}
-		}
-		if (record.IsLeftRightBalanceValid()) {
-			uint8_t lr_bal = record.GetLeftRightBalance();
-			if (lr_bal != 0xFF) {                      // Check for invalid value
-				fitRecord.left_right_balance = lr_bal; // Already in percentage
-			}
-		}
-		if (record.IsLeftTorqueEffectivenessValid()) {
-			uint8_t lte = record.GetLeftTorqueEffectiveness();
-			if (lte != 0xFF) {                                   // Check for invalid value
-				fitRecord.left_torque_effectiveness = lte / 2.0; // Convert from scaled value
-			}
-		}
-		if (record.IsRightTorqueEffectivenessValid()) {
-			uint8_t rte = record.GetRightTorqueEffectiveness();
-			if (rte != 0xFF) {                                    // Check for invalid value
-				fitRecord.right_torque_effectiveness = rte / 2.0; // Convert from scaled value
-			}
+	// Destination fields of the components expanded per message family, only those the collector
+	// reads. Sessions and laps only hold enhanced_* fields the collector does not read.
+	std::unordered_map<FIT_UINT16, std::unordered_set<FIT_UINT8>> ExpandedFields() const {
+		std::unordered_map<FIT_UINT16, std::unordered_set<FIT_UINT8>> expanded;
+		auto &record_nums = expanded[FIT_MESG_NUM_RECORD];
+		for (auto field : record_fields) {
+			record_nums.insert(field->field_num);
+		}
+		AddFitComponentSources(FIT_MESG_NUM_RECORD, record_nums);
+		expanded[FIT_MESG_NUM_EVENT] = {fit::EventMesg::FieldDefNum::Data,
+		                                fit::EventMesg::FieldDefNum::Score,
+		                                fit::EventMesg::FieldDefNum::OpponentScore,
+		                                fit::EventMesg::FieldDefNum::FrontGearNum,
+		                                fit::EventMesg::FieldDefNum::FrontGear,
+		                                fit::EventMesg::FieldDefNum::RearGearNum,
+		                                fit::EventMesg::FieldDefNum::RearGear};
+		expanded.emplace(FIT_MESG_NUM_SESSION, std::unordered_set<FIT_UINT8>());
+		expanded.emplace(FIT_MESG_NUM_LAP, std::unordered_set<FIT_UINT8>());
+		return expanded;
+	}
+
+};
+
+// FIT message listener to collect all types of data
+class FitDataCollector : public fit::RecordMesgListener,
+                         public fit::FileIdMesgListener,
+                         public fit::ActivityMesgListener,
+                         public fit::SessionMesgListener,
+                         public fit::LapMesgListener,
+                         public fit::DeviceInfoMesgListener,
+                         public fit::EventMesgListener,
+                         public fit::UserProfileMesgListener,
+                         public fit::RawMesgListener {
+public:
+	FitColumnBuffer records;
+	string record_activity_type; // Sport of the file's session, the activity_type of its records
+	std::vector<FitActivity> activities;
+	std::vector<FitSession> sessions;
+	std::vector<FitLap> laps;
+	std::vector<FitDevice> devices;
+	std::vector<FitEvent> events;
+	std::vector<FitUser> users;
+	string file_type;
+	string manufacturer;
+	string activity_name;
+	string current_file_source;   // Track current file being processed
+	bool crc_valid;               // True once the file CRC was verified
+
+	// Only the record fields of the plan are extracted, every other record field is skipped.
+	// Without plan records, record messages are dropped without looking at their fields.
+	explicit FitDataCollector(const FitDecodePlan &plan)
+	    : records(FitRecordFieldWidths(plan.record_fields)), current_file_source(""), crc_valid(false),
+	      decode_plan(plan), collect_records(plan.records), record_fields(plan.record_fields),
+	      record_extractor(FIT_MESG_NUM_RECORD, FitRecordFieldNums(record_fields)),
+	      timestamp_range(plan.timestamp_range), stop_after_range(false), decoder(nullptr), record_limit(0),
+	      stopped(false), record_span {false, 0, 0, true}, record_span_known(plan.record_filters.empty()),
+	      previous_timestamp(0) {
+		// The timestamp is the first record column
+		timestamp_slot = RecordSlot(FIT_RECORD_COLUMNS[0]);
+		for (auto &filter : plan.record_filters) {
+			record_extractor.AddFilter(RecordSlot(*filter.column), filter.raw_min, filter.raw_max);
+		}
+		if (!plan.expand_components) {
+			record_extractor.SuppressComponentExpansion();
 		}
-		if (record.IsLeftPedalSmoothnessValid()) {
-			uint8_t lps = record.GetLeftPedalSmoothness();
-			if (lps != 0xFF) {                               // Check for invalid value
-				fitRecord.left_pedal_smoothness = lps / 2.0; // Convert from scaled value
-			}
+	}
+
+	// Decoder to pause once the records pass the timestamp range, nullptr after decoding
+	void SetDecoder(fit::Decode *decode) {
+		decoder = decode;
+	}
+
+	// Pauses the decoder at the first record past the timestamp range, only for a file whose
+	// records are known to be in time order
+	void StopAfterRange() {
+		stop_after_range = true;
+	}
+
+	// Pauses the decoder once the file has that many records, 0 to decode all of them
+	void SetRecordLimit(idx_t limit) {
+		record_limit = limit;
+	}
+
+	// True once decoding stopped at the first record past the timestamp range
+	bool IsStopped() const {
+		return stopped;
+	}
+
+	// Timestamps of the earliest and latest record of the file
+	// Returns false if the file was not decoded completely, has records without a timestamp or
+	// records were dropped before their timestamp was seen
+	bool GetRecordSpan(FitRecordSpan &span) const {
+		if (stopped || !record_span_known || timestamp_slot == DConstants::INVALID_INDEX) {
+			return false;
 		}
-		if (record.IsRightPedalSmoothnessValid()) {
-			uint8_t rps = record.GetRightPedalSmoothness();
-			if (rps != 0xFF) {                                // Check for invalid value
-				fitRecord.right_pedal_smoothness = rps / 2.0; // Convert from scaled value
+		span = record_span;
+		return true;
+	}
+
+	// Row counts of the tables and value ranges of the statistics columns this file was decoded for.
+	// Records dropped by the filters of the scan or not reached leave the records unknown.
+	void GetStatistics(FitFileStatistics &statistics) const {
+		auto &plan = decode_plan;
+		if (stopped) {
+			return;
+		}
+		idx_t rows[FIT_TABLE_COUNT] = {records.size(), activities.size(), sessions.size(), laps.size(),
+		                               devices.size(), events.size(),     users.size()};
+		bool decoded[FIT_TABLE_COUNT] = {plan.records && !plan.timestamp_range.IsSet() && plan.record_filters.empty(),
+		                                 plan.activities && plan.file_ids,
+		                                 plan.sessions,
+		                                 plan.laps,
+		                                 plan.devices,
+		                                 plan.events,
+		                                 plan.users};
+		for (idx_t i = 0; i < FIT_TABLE_COUNT; i++) {
+			if (decoded[i]) {
+				statistics.rows[i] = rows[i];
 			}
 		}
-		if (record.IsCombinedPedalSmoothnessValid()) {
-			uint8_t cps = record.GetCombinedPedalSmoothness();
-			if (cps != 0xFF) {                                   // Check for invalid value
-				fitRecord.combined_pedal_smoothness = cps / 2.0; // Convert from scaled value
-			}
+		// Without component expansion, values such as the distance of compressed_speed_distance are missing
+		if (!decoded[0] || !plan.expand_components) {
+			return;
 		}
-		if (record.IsLeftPcoValid()) {
-			int8_t lpco = record.GetLeftPco();
-			if (lpco != 0x7F) {            // Check for invalid value
-				fitRecord.left_pco = lpco; // Already in mm
+		for (idx_t slot = 0; slot < record_fields.size(); slot++) {
+			auto index = GetFitRecordStatisticsIndex(*record_fields[slot]);
+			if (index == DConstants::INVALID_INDEX) {
+				continue;
 			}
-		}
-		if (record.IsRightPcoValid()) {
-			int8_t rpco = record.GetRightPco();
-			if (rpco != 0x7F) {             // Check for invalid value
-				fitRecord.right_pco = rpco; // Already in mm
+			auto &range = statistics.values[index];
+			range = {true, false, 0, 0};
+			for (idx_t row = 0; row < records.size(); row++) {
+				auto data = records.GetValue(slot, row);
+				if (data) {
+					auto value = LoadFitRecordColumnValue(*record_fields[slot], data);
+					range.Merge({true, true, value, value});
+				}
 			}
 		}
+	}
 
-		// Running metrics
-		if (record.IsVerticalOscillationValid()) {
-			uint16_t vo = record.GetVerticalOscillation();
-			if (vo != 0xFFFF) {                             // Check for invalid value
-				fitRecord.vertical_oscillation = vo / 10.0; // Convert from scaled value (mm)
-			}
-		}
-		if (record.IsStanceTimePercentValid()) {
-			uint16_t stp = record.GetStanceTimePercent();
-			if (stp != 0xFFFF) {                             // Check for invalid value
-				fitRecord.stance_time_percent = stp / 100.0; // Convert from scaled value
+	const vector<const FitRecordColumn *> &GetRecordFields() const {
+		return record_fields;
+	}
+
+	// Column of the record buffer holding a record column, INVALID_INDEX if it was not extracted
+	idx_t RecordSlot(const FitRecordColumn &column) const {
+		auto slot = std::find(record_fields.begin(), record_fields.end(), &column);
+		return slot != record_fields.end() ? idx_t(slot - record_fields.begin()) : DConstants::INVALID_INDEX;
+	}
+
+	// Approximate size of the collected rows, strings excluded
+	idx_t GetMemoryUsage() const {
+		return sizeof(*this) + records.GetMemoryUsage() + activities.capacity() * sizeof(FitActivity) +
+		       sessions.capacity() * sizeof(FitSession) + laps.capacity() * sizeof(FitLap) +
+		       devices.capacity() * sizeof(FitDevice) + events.capacity() * sizeof(FitEvent) +
+		       users.capacity() * sizeof(FitUser);
+	}
+
+	// Method to set the current file being processed
+	void SetCurrentFile(const string &file_path) {
+		current_file_source = file_path;
+	}
+
+	// Completes the rows of a decoded file with data from messages that may follow them
+	void FinishFile() {
+		// Records take the sport of the file's last session that has one
+		for (const auto &session : sessions) {
+			if (!session.sport.empty()) {
+				record_activity_type = session.sport;
 			}
 		}
-		if (record.IsStanceTimeValid()) {
-			uint16_t st = record.GetStanceTime();
-			if (st != 0xFFFF) {                    // Check for invalid value
-				fitRecord.stance_time = st / 10.0; // Convert from scaled value (ms)
+
+		// The first activity takes the summary of the first session
+		if (!sessions.empty() && !activities.empty()) {
+			auto &session = sessions[0];
+			auto &activity = activities[0];
+
+			// Copy sport information
+			activity.sport = session.sport;
+			activity.sub_sport = session.sub_sport;
+
+			// Copy performance data
+			activity.total_distance = session.total_distance;
+			activity.total_elapsed_time = session.total_elapsed_time;
+			activity.total_calories = session.total_calories;
+			activity.avg_heart_rate = session.avg_heart_rate;
+			activity.max_heart_rate = session.max_heart_rate;
+			activity.avg_speed = session.avg_speed;
+			activity.max_speed = session.max_speed;
+			activity.avg_power = session.avg_power;
+			activity.max_power = session.max_power;
+			activity.avg_cadence = session.avg_cadence;
+			activity.max_cadence = session.max_cadence;
+			activity.total_ascent = session.total_ascent;
+			activity.total_descent = session.total_descent;
+
+			// Copy start time if not already set
+			if (activity.start_time.value == 0 && session.start_time.value != 0) {
+				activity.start_time = session.start_time;
 			}
 		}
-		if (record.IsStanceTimeBalanceValid()) {
-			uint16_t stb = record.GetStanceTimeBalance();
-			if (stb != 0xFFFF) {                             // Check for invalid value
-				fitRecord.stance_time_balance = stb / 100.0; // Convert from scaled value
-			}
+	}
+
+	// Record messages are extracted straight from the raw message data with a plan compiled
+	// per definition; definitions the plan does not cover arrive as decoded RecordMesg
+	FIT_BOOL OnRawMesgDefinition(const fit::MesgDefinition &mesgDef, FIT_BOOL bigEndian) override {
+		if (mesgDef.GetNum() != FIT_MESG_NUM_RECORD) {
+			return FIT_FALSE;
 		}
-		if (record.IsStepLengthValid()) {
-			uint16_t sl = record.GetStepLength();
-			if (sl != 0xFFFF) {                    // Check for invalid value
-				fitRecord.step_length = sl / 10.0; // Convert from scaled value (mm)
-			}
+		return !collect_records || record_extractor.Compile(mesgDef, bigEndian);
+	}
+
+	void OnRawMesg(const fit::MesgDefinition &mesgDef, const FIT_UINT8 *data, FIT_UINT32 timestamp) override {
+		if (!collect_records) {
+			return;
 		}
-		if (record.IsVerticalRatioValid()) {
-			uint16_t vr = record.GetVerticalRatio();
-			if (vr != 0xFFFF) {                        // Check for invalid value
-				fitRecord.vertical_ratio = vr / 100.0; // Convert from scaled value
-			}
+		if (record_extractor.Extract(mesgDef.GetLocalNum(), data, timestamp, record_values, record_valid)) {
+			AddRecord();
 		}
+	}
 
-		// Continue with other fields with proper invalid value checking...
-		// (Rest of the fields follow the same pattern)
-
-		// Set activity type from current session
-		fitRecord.activity_type = current_activity_type;
-		fitRecord.file_source = current_file_source;
-
-		records.push_back(fitRecord);
+	void OnMesg(fit::RecordMesg &record) override {
+		if (record_extractor.Extract(record, record_values, record_valid)) {
+			AddRecord();
+		}
 	}
 
 	void OnMesg(fit::FileIdMesg &file_id) override {
@@ -884,8 +1112,6 @@ public:
 		if (session.IsSportValid()) {
 			uint8_t sport_code = session.GetSport();
 			fit_session.sport = ConvertSportToString(sport_code);
-			// Update current activity type for subsequent records
-			current_activity_type = ConvertSportToString(sport_code);
 		}
 
 		if (session.IsSubSportValid()) {
@@ -1317,1118 +1543,2353 @@ public:
 		fit_user.file_source = current_file_source;
 		users.push_back(fit_user);
 	}
-};
-
-struct FitTableFunctionData : public TableFunctionData {
-	string input_name;
-	idx_t current_row;
-	std::vector<FitRecord> fit_records;
-	std::vector<FitActivity> fit_activities;
-	std::vector<FitSession> fit_sessions;
-	std::vector<FitLap> fit_laps;
-	std::vector<FitDevice> fit_devices;
-	std::vector<FitEvent> fit_events;
-	std::vector<FitUser> fit_users;
-	string user_timezone;
-	string table_type; // To distinguish which table this data is for
 
-	FitTableFunctionData(string name, string type = "records", ClientContext *context = nullptr)
-	    : input_name(name), current_row(0), user_timezone("UTC"), table_type(type) {
-		// Get user's timezone setting if context is available
-		if (context) {
-			Value timezone_value;
-			if (context->TryGetCurrentSetting("TimeZone", timezone_value)) {
-				user_timezone = timezone_value.ToString();
+private:
+	FitDecodePlan decode_plan;
+	bool collect_records;
+	vector<const FitRecordColumn *> record_fields;
+	FitFieldExtractor record_extractor;
+	double record_values[FIT_RECORD_COLUMN_COUNT];
+	bool record_valid[FIT_RECORD_COLUMN_COUNT];
+	FitTimestampRange timestamp_range;
+	bool stop_after_range;
+	fit::Decode *decoder;
+	idx_t record_limit;
+	bool stopped;
+	idx_t timestamp_slot;
+	FitRecordSpan record_span;
+	bool record_span_known;
+	int64_t previous_timestamp;
+
+	// Tracks the span of the record timestamps
+	// Returns false if the record is outside of the timestamp range of the scan
+	bool InTimestampRange() {
+		if (timestamp_slot == DConstants::INVALID_INDEX) {
+			return true;
+		}
+		if (!record_valid[timestamp_slot]) {
+			record_span_known = false;
+			return true;
+		}
+		auto timestamp = (int64_t)record_values[timestamp_slot];
+		if (!record_span.has_records) {
+			record_span = {true, timestamp, timestamp, true};
+		} else if (timestamp < previous_timestamp) {
+			record_span.ordered = false;
+		}
+		previous_timestamp = timestamp;
+		record_span.first = MinValue(record_span.first, timestamp);
+		record_span.last = MaxValue(record_span.last, timestamp);
+
+		if (timestamp > timestamp_range.max) {
+			if (stop_after_range && decoder) {
+				decoder->Pause();
+				stopped = true;
 			}
+			return false;
 		}
-		// Load and parse FIT file
-		LoadFitFile();
+		return timestamp >= timestamp_range.min;
 	}
 
-private:
-	void LoadFitFile() {
-		try {
-			// Check for empty or null input
-			if (input_name.empty()) {
-				throw std::runtime_error("File path cannot be empty");
+	void AddRecord() {
+		if (!InTimestampRange()) {
+			return;
+		}
+		idx_t row = records.AppendRow();
+		for (idx_t i = 0; i < record_fields.size(); i++) {
+			if (record_valid[i]) {
+				record_fields[i]->store(records.SetValid(i, row), record_values[i]);
 			}
+		}
+		if (record_limit > 0 && records.size() >= record_limit && decoder) {
+			decoder->Pause();
+		}
+	}
+};
 
-			// Expand glob pattern to get list of files
-			vector<string> files = ExpandGlobPattern(input_name);
-
-			// Check if pattern contains wildcards
-			bool has_wildcards = (input_name.find('*') != string::npos || input_name.find('?') != string::npos ||
-			                      input_name.find('[') != string::npos);
-
-			if (files.empty()) {
-				if (has_wildcards) {
-					// For wildcard patterns, return an empty result (valid schema, 0 rows)
-					fit_records.clear();
-					fit_activities.clear();
-					fit_sessions.clear();
-					fit_laps.clear();
-					fit_devices.clear();
-					fit_events.clear();
-					fit_users.clear();
-					return;
-				} else {
-					// For non-wildcard patterns, throw a more specific error
-					throw std::runtime_error("Cannot open FIT file: " + input_name);
-				}
-			}
+// How the file CRC is verified, selected with the crc_check named parameter
+enum class FitCrcCheck : uint8_t {
+	STRICT,   // verify the whole file before decoding it (default)
+	DEFERRED, // decode first, verify the whole file in one pass afterwards
+	OFF       // trust the file, never compute the CRC
+};
 
-			// For non-wildcard patterns, validate the single file exists and is readable
-			if (!has_wildcards && files.size() == 1) {
-				std::fstream test_file;
-				test_file.open(files[0], std::ios::in | std::ios::binary);
-				if (!test_file.is_open()) {
-					throw std::runtime_error("Cannot open FIT file: " + input_name);
-				}
-				test_file.close();
+// Named parameters shared by all FIT table functions
+struct FitScanOptions {
+	FitCrcCheck crc_check = FitCrcCheck::STRICT;
+	// Expose key=value directories of the file paths as columns
+	bool hive_partitioning = false;
+	// Expand the components of fields into other fields, e.g. enhanced_speed from speed
+	bool expand_components = true;
+};
+
+static FitScanOptions ParseScanOptions(const TableFunctionBindInput &input) {
+	FitScanOptions options;
+	for (const auto &param : input.named_parameters) {
+		auto name = StringUtil::Lower(param.first);
+		if (name == "crc_check") {
+			auto mode = param.second.IsNull() ? string() : StringUtil::Lower(param.second.ToString());
+			if (mode == "strict") {
+				options.crc_check = FitCrcCheck::STRICT;
+			} else if (mode == "deferred") {
+				options.crc_check = FitCrcCheck::DEFERRED;
+			} else if (mode == "off") {
+				options.crc_check = FitCrcCheck::OFF;
+			} else {
+				throw BinderException("Invalid value '%s' for crc_check, expected 'strict', 'deferred' or 'off'",
+				                      param.second.ToString());
 			}
+		} else if (name == "hive_partitioning") {
+			options.hive_partitioning = !param.second.IsNull() && BooleanValue::Get(param.second);
+		} else if (name == "expand_components") {
+			options.expand_components = param.second.IsNull() || BooleanValue::Get(param.second);
+		}
+	}
+	return options;
+}
 
-			// Create shared collector that will accumulate data from all files
-			FitDataCollector collector;
-
-			// Process each file
-			for (const auto &file_path : files) {
-				try {
-					std::fstream file;
-					file.open(file_path, std::ios::in | std::ios::binary);
-
-					if (!file.is_open()) {
-						if (!has_wildcards) {
-							// For single files, this is an error
-							throw std::runtime_error("Cannot open FIT file: " + file_path);
-						}
-						// For wildcard patterns, skip files that can't be opened
-						continue;
-					}
+static void AddScanParameters(TableFunction &function) {
+	function.named_parameters["crc_check"] = LogicalType::VARCHAR;
+	function.named_parameters["hive_partitioning"] = LogicalType::BOOLEAN;
+	function.named_parameters["expand_components"] = LogicalType::BOOLEAN;
+}
 
-					// Set current file in collector
-					collector.SetCurrentFile(file_path);
+// Which collected values are emitted as NULL: summary rows are zero initialized, so a zero usually
+// means the value was missing from the file
+enum class FitNull : uint8_t { NEVER, IF_ZERO, IF_NOT_POSITIVE };
 
-					fit::Decode decode;
-					fit::MesgBroadcaster mesgBroadcaster;
+template <class T>
+static bool IsFitNull(const T &value, FitNull null_if) {
+	return (null_if == FitNull::IF_ZERO && value == 0) || (null_if == FitNull::IF_NOT_POSITIVE && value <= 0);
+}
 
-					// Check file integrity
-					if (!decode.CheckIntegrity(file)) {
-						// Continue anyway, might still be readable
-					}
+static bool IsFitNull(const string &value, FitNull null_if) {
+	return null_if != FitNull::NEVER && value.empty();
+}
 
-					// Add listeners for all message types
-					mesgBroadcaster.AddListener((fit::RecordMesgListener &)collector);
-					mesgBroadcaster.AddListener((fit::FileIdMesgListener &)collector);
-					mesgBroadcaster.AddListener((fit::ActivityMesgListener &)collector);
-					mesgBroadcaster.AddListener((fit::SessionMesgListener &)collector);
-					mesgBroadcaster.AddListener((fit::LapMesgListener &)collector);
-					mesgBroadcaster.AddListener((fit::DeviceInfoMesgListener &)collector);
-					mesgBroadcaster.AddListener((fit::EventMesgListener &)collector);
-					mesgBroadcaster.AddListener((fit::UserProfileMesgListener &)collector);
-
-					// Decode the file
-					decode.Read(&file, &mesgBroadcaster, &mesgBroadcaster, nullptr);
-
-					file.close();
-
-				} catch (const std::exception &e) {
-					if (!has_wildcards) {
-						// For single files, propagate the error
-						throw std::runtime_error("Error reading FIT file '" + file_path + "': " + string(e.what()));
-					}
-					// For wildcard patterns, continue with next file if one fails
-					continue;
+static bool IsFitNull(const timestamp_tz_t &value, FitNull null_if) {
+	return false;
+}
+
+// Output column of a table function, written from the collected rows of its table
+template <class ROW>
+struct FitColumn {
+	const char *name;
+	LogicalTypeId type;
+	// Writes count rows into result, starting at row offset of the output
+	void (*write)(const ROW *rows, idx_t count, Vector &result, idx_t offset);
+	// Writes the values of all rows to a sidecar and reads them back
+	void (*save)(const std::vector<ROW> &rows, FitSidecarWriter &writer);
+	void (*load)(std::vector<ROW> &rows, FitSidecarReader &reader);
+};
+
+// Physical value a member is written as, strings are copied into the string heap of the vector
+template <class T>
+struct FitVectorValue {
+	typedef T type;
+	static T Convert(Vector &result, const T &value) {
+		return value;
+	}
+};
+
+template <>
+struct FitVectorValue<string> {
+	typedef string_t type;
+	static string_t Convert(Vector &result, const string &value) {
+		return StringVector::AddString(result, value);
+	}
+};
+
+template <class ROW, class T, T ROW::*MEMBER, FitNull NULL_IF>
+static void WriteFitColumn(const ROW *rows, idx_t count, Vector &result, idx_t offset) {
+	auto data = FlatVector::GetData<typename FitVectorValue<T>::type>(result);
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t row = 0; row < count; row++) {
+		const T &value = rows[row].*MEMBER;
+		if (IsFitNull(value, NULL_IF)) {
+			validity.SetInvalid(offset + row);
+			continue;
+		}
+		data[offset + row] = FitVectorValue<T>::Convert(result, value);
+	}
+}
+
+// Sidecar values: fixed size members are copied as they are, strings are length prefixed
+template <class T>
+static void SaveFitValue(FitSidecarWriter &writer, const T &value) {
+	writer.Write<T>(value);
+}
+
+static void SaveFitValue(FitSidecarWriter &writer, const string &value) {
+	writer.WriteString(value);
+}
+
+template <class T>
+static void LoadFitValue(FitSidecarReader &reader, T &value) {
+	value = reader.Read<T>();
+}
+
+static void LoadFitValue(FitSidecarReader &reader, string &value) {
+	value = reader.ReadString();
+}
+
+template <class ROW, class T, T ROW::*MEMBER>
+static void SaveFitColumn(const std::vector<ROW> &rows, FitSidecarWriter &writer) {
+	for (auto &row : rows) {
+		SaveFitValue(writer, row.*MEMBER);
+	}
+}
+
+template <class ROW, class T, T ROW::*MEMBER>
+static void LoadFitColumn(std::vector<ROW> &rows, FitSidecarReader &reader) {
+	for (auto &row : rows) {
+		LoadFitValue(reader, row.*MEMBER);
+	}
+}
+
+// Column named after the ROW member it is read from
+#define FIT_COLUMN(ROW, NAME, TYPE, NULL_IF)                                                                           \
+	{                                                                                                                  \
+		#NAME, LogicalTypeId::TYPE, WriteFitColumn<ROW, decltype(ROW::NAME), &ROW::NAME, FitNull::NULL_IF>,            \
+		    SaveFitColumn<ROW, decltype(ROW::NAME), &ROW::NAME>, LoadFitColumn<ROW, decltype(ROW::NAME), &ROW::NAME>   \
+	}
+
+template <class COLUMN, idx_t N>
+static void AddFitColumns(const COLUMN (&columns)[N], vector<LogicalType> &return_types, vector<string> &names) {
+	for (auto &column : columns) {
+		names.push_back(column.name);
+		return_types.push_back(LogicalType(column.type));
+	}
+}
+
+// Decoded files shared by all scans of the process, sized by the fit_cache_memory_limit setting
+static FitFileCache<FitDataCollector> &GetFitFileCache() {
+	static FitFileCache<FitDataCollector> cache;
+	return cache;
+}
+
+// Record time spans of the files decoded by the process, for the timestamp filters of later scans
+static FitFileIndex<FitRecordSpan> &GetFitRecordSpans() {
+	static FitFileIndex<FitRecordSpan> spans(1 << 20);
+	return spans;
+}
+
+// Row counts and value ranges of the files decoded by the process, for the estimates and statistics
+// of later scans
+static FitFileIndex<FitFileStatistics> &GetFitFileStatistics() {
+	static FitFileIndex<FitFileStatistics> statistics(1 << 16);
+	return statistics;
+}
+
+// Adds what a decode of a file tells about it to the statistics of the file
+static void IndexFitFileStatistics(const FitFileKey &key, const FitDataCollector &collector) {
+	auto &index = GetFitFileStatistics();
+	FitFileStatistics statistics;
+	if (index.Get(key, statistics) && statistics.IsComplete()) {
+		return;
+	}
+	FitFileStatistics decoded;
+	collector.GetStatistics(decoded);
+	statistics.Merge(decoded);
+	index.Put(key, statistics);
+}
+
+// Takes the units of memory_limit (e.g. '512MB'), a plain 0 disables the cache
+static idx_t ParseFitCacheMemoryLimit(const Value &limit) {
+	auto text = limit.IsNull() ? string("0") : StringUtil::Lower(limit.ToString());
+	return text == "0" ? 0 : DBConfig::ParseMemoryLimit(text);
+}
+
+// Validates a new fit_cache_memory_limit and resizes the cache right away. The cache is shared by
+// the whole process, so the setting only has a global scope.
+static void SetFitCacheMemoryLimit(ClientContext &context, SetScope scope, Value &parameter) {
+	if (scope != SetScope::GLOBAL) {
+		throw InvalidInputException("fit_cache_memory_limit sizes the cache of the whole process, use SET GLOBAL "
+		                            "fit_cache_memory_limit");
+	}
+	GetFitFileCache().SetMemoryLimit(ParseFitCacheMemoryLimit(parameter));
+}
+
+// Key of a file in the file cache, false for files that are never cached (pipes, devices)
+static bool GetFitFileKey(FileSystem &fs, const string &path, FitFileKey &key) {
+	struct stat file_stat;
+	if (stat(path.c_str(), &file_stat) != 0) {
+		// Not a local path as is (a URL, ~/ or file://): size and modification time as reported by
+		// its file system
+		try {
+			auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+			if (!handle->CanSeek()) {
+				return false;
+			}
+			key.path = path;
+			key.size = handle->GetFileSize();
+			key.modified_time = Timestamp::GetEpochNanoSeconds(fs.GetLastModifiedTime(*handle));
+			return true;
+		} catch (const std::exception &) {
+			return false;
+		}
+	}
+	if (!S_ISREG(file_stat.st_mode)) {
+		return false;
+	}
+	key.path = path;
+	key.size = file_stat.st_size;
+	// In nanoseconds, a file rewritten within the same second is another version
+#ifdef __APPLE__
+	key.modified_time = int64_t(file_stat.st_mtimespec.tv_sec) * 1000000000 + file_stat.st_mtimespec.tv_nsec;
+#else
+	key.modified_time = int64_t(file_stat.st_mtim.tv_sec) * 1000000000 + file_stat.st_mtim.tv_nsec;
+#endif
+	return true;
+}
+
+// Size of the record data messages of a file, from the first record definition among its first
+// messages. Returns 0 if there is none.
+static idx_t FindFitRecordMessageSize(const_data_ptr_t data, idx_t size) {
+	idx_t message_sizes[FIT_MAX_LOCAL_MESGS] = {0};
+	idx_t position = size > 0 ? data[0] : 0; // Header size
+	while (position < size) {
+		auto header = data[position];
+		if (header & FIT_HDR_TIME_REC_BIT) {
+			// Data message with a compressed timestamp
+			auto local_num = (header & FIT_HDR_TIME_TYPE_MASK) >> FIT_HDR_TIME_TYPE_SHIFT;
+			if (message_sizes[local_num] == 0) {
+				return 0;
+			}
+			position += message_sizes[local_num];
+		} else if (header & FIT_HDR_TYPE_DEF_BIT) {
+			if (position + 6 > size) {
+				return 0;
+			}
+			bool big_endian = data[position + 2] == FIT_ARCH_ENDIAN_BIG;
+			FIT_UINT16 global_num = big_endian ? (data[position + 3] << 8) | data[position + 4]
+			                                   : data[position + 3] | (data[position + 4] << 8);
+			idx_t message_size = 1;
+			idx_t next = position + 6 + idx_t(data[position + 5]) * 3;
+			for (idx_t field = position + 6; field < next && field + 1 < size; field += 3) {
+				message_size += data[field + 1];
+			}
+			if ((header & FIT_HDR_DEV_FIELD_BIT) && next < size) {
+				idx_t developer_next = next + 1 + idx_t(data[next]) * 3;
+				for (idx_t field = next + 1; field < developer_next && field + 1 < size; field += 3) {
+					message_size += data[field + 1];
 				}
+				next = developer_next;
+			}
+			if (global_num == FIT_MESG_NUM_RECORD) {
+				return message_size;
 			}
+			message_sizes[header & FIT_HDR_TYPE_MASK] = message_size;
+			position = next;
+		} else {
+			if (message_sizes[header & FIT_HDR_TYPE_MASK] == 0) {
+				return 0;
+			}
+			position += message_sizes[header & FIT_HDR_TYPE_MASK];
+		}
+	}
+	return 0;
+}
+
+// Rows of a table in a file that was not decoded yet. Records are estimated from the size of the
+// file and of the record messages, the other tables from what activity files typically hold.
+static idx_t EstimateFitRows(FileSystem &fs, const string &table_type, const FitFileKey &key) {
+	if (table_type == "laps" || table_type == "devices") {
+		return 10;
+	}
+	if (table_type == "events") {
+		return 50;
+	}
+	if (table_type != "records") {
+		return 1;
+	}
+	// Records make up most of an activity file, the definitions are near its start
+	idx_t message_size = 0;
+	try {
+		auto handle = fs.OpenFile(key.path, FileFlags::FILE_FLAGS_READ);
+		std::vector<data_t> data(MinValue<idx_t>(key.size, 64 * 1024));
+		handle->Read(data.data(), data.size(), 0);
+		message_size = FindFitRecordMessageSize(data.data(), data.size());
+	} catch (const std::exception &) {
+		// Estimated with a typical record size
+	}
+	return key.size / (message_size > 0 ? message_size : 32);
+}
+
+// File patterns of the first argument of the table functions, a single pattern or a list of them
+static vector<string> GetFitFilePatterns(const Value &input) {
+	vector<string> patterns;
+	if (input.IsNull()) {
+		return patterns;
+	}
+	if (input.type().id() != LogicalTypeId::LIST) {
+		patterns.push_back(input.GetValue<string>());
+		return patterns;
+	}
+	for (auto &pattern : ListValue::GetChildren(input)) {
+		patterns.push_back(pattern.IsNull() ? string() : pattern.GetValue<string>());
+	}
+	return patterns;
+}
+
+// Hive partitions of a file, the key=value directories of its path (athlete=123/year=2025/ride.fit)
+static vector<std::pair<string, string>> GetFitFilePartitions(const string &path) {
+	vector<std::pair<string, string>> partitions;
+	idx_t start = 0;
+	for (idx_t i = 0; i < path.size(); i++) {
+		if (path[i] != '/' && path[i] != '\\') {
+			continue;
+		}
+		auto segment = path.substr(start, i - start);
+		auto equals = segment.find('=');
+		if (equals != string::npos && equals > 0) {
+			partitions.emplace_back(segment.substr(0, equals), segment.substr(equals + 1));
+		}
+		start = i + 1;
+	}
+	return partitions;
+}
+
+// Partition values made of digits only are typed BIGINT, any other value makes the column VARCHAR
+static bool IsFitPartitionInteger(const string &value) {
+	idx_t start = !value.empty() && value[0] == '-' ? 1 : 0;
+	if (value.size() <= start || value.size() - start > 18) {
+		return false;
+	}
+	for (idx_t i = start; i < value.size(); i++) {
+		if (value[i] < '0' || value[i] > '9') {
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool IsFitPartitionNull(const string &value) {
+	return value == "NULL" || value == "__HIVE_DEFAULT_PARTITION__";
+}
+
+// Sidecar of a file in the cache directory, named after a hash (FNV-1a) of the file path
+static string GetFitSidecarPath(const string &directory, const string &file_path) {
+	uint64_t hash = 14695981039346656037ULL;
+	for (unsigned char c : file_path) {
+		hash = (hash ^ c) * 1099511628211ULL;
+	}
+	char name[32];
+	snprintf(name, sizeof(name), "%016llx.fitc", (unsigned long long)hash);
+	return directory + "/" + name;
+}
 
-			// Copy collected data from all files
-			fit_records = std::move(collector.records);
-			fit_activities = std::move(collector.activities);
-			fit_sessions = std::move(collector.sessions);
-			fit_laps = std::move(collector.laps);
-			fit_devices = std::move(collector.devices);
-			fit_events = std::move(collector.events);
-			fit_users = std::move(collector.users);
-
-			// Post-process: populate activity_type from session data
-			// This is now done per file, but we keep this for backward compatibility
-			if (!fit_sessions.empty() && !fit_records.empty()) {
-				// Group records by file source and apply activity types accordingly
-				std::map<string, string> file_activity_types;
-
-				// Build mapping of file -> activity type from sessions
-				for (const auto &session : fit_sessions) {
-					if (!session.sport.empty() && !session.file_source.empty()) {
-						file_activity_types[session.file_source] = session.sport;
+// Creates the cache directory and its missing parents
+static void CreateFitCacheDirectory(FileSystem &fs, const string &directory) {
+	if (directory.empty() || fs.DirectoryExists(directory)) {
+		return;
+	}
+	auto separator = directory.find_last_of('/');
+	if (separator != string::npos && separator > 0) {
+		CreateFitCacheDirectory(fs, directory.substr(0, separator));
+	}
+	fs.CreateDirectory(directory);
+}
+
+// Defined with the columns of the tables, which the sidecar is written with
+static shared_ptr<FitDataCollector> ReadFitSidecar(FileSystem &fs, const string &sidecar_path, const FitFileKey &key);
+static void WriteFitSidecar(const string &sidecar_path, const FitFileKey &key, const FitDataCollector &collector);
+
+struct FitTableFunctionData : public TableFunctionData {
+	vector<string> patterns;
+	vector<string> files;
+	bool has_wildcards;
+	vector<string> column_names;
+	string user_timezone;
+	string table_type; // To distinguish which table this data is for
+	FitScanOptions options;
+	idx_t cache_memory_limit; // 0 when decoded files are not kept in memory
+	string cache_directory;   // Empty when decoded files are not kept on disk
+	// Records outside of the range of the timestamp filters are skipped
+	FitTimestampRange timestamp_range;
+	// Records failing the comparisons of numeric record fields with constants are skipped
+	vector<FitRecordFilter> record_filters;
+	// Hive partition columns, after the columns of the table, and their value for each file
+	vector<string> partition_names;
+	vector<LogicalType> partition_types;
+	vector<vector<Value>> partition_values;
+
+private:
+	mutable std::mutex statistics_lock;
+	mutable bool statistics_loaded = false;
+	mutable FitValueRange record_value_ranges[FIT_RECORD_STATISTICS_COUNT];
+
+public:
+
+	// Files are only listed when binding, the scan decodes them one at a time
+	FitTableFunctionData(vector<string> patterns_p, string type, vector<string> column_names_p,
+	                     ClientContext &context, FitScanOptions options_p)
+	    : patterns(std::move(patterns_p)), has_wildcards(false), column_names(std::move(column_names_p)),
+	      user_timezone("UTC"), table_type(type), options(options_p), cache_memory_limit(0) {
+		// Get user's timezone setting
+		Value timezone_value;
+		if (context.TryGetCurrentSetting("TimeZone", timezone_value)) {
+			user_timezone = timezone_value.ToString();
+		}
+		// Whether this scan uses the cache. The cache is shared by every connection and only resized
+		// when the setting is changed.
+		Value cache_limit_value;
+		if (context.TryGetCurrentSetting("fit_cache_memory_limit", cache_limit_value)) {
+			cache_memory_limit = ParseFitCacheMemoryLimit(cache_limit_value);
+		}
+		Value cache_directory_value;
+		if (context.TryGetCurrentSetting("fit_cache_directory", cache_directory_value) &&
+		    !cache_directory_value.IsNull()) {
+			cache_directory = cache_directory_value.ToString();
+		}
+		if (!cache_directory.empty()) {
+			// Created here so that a directory that cannot be created fails the query, sidecars that
+			// cannot be written later are skipped
+			try {
+				CreateFitCacheDirectory(FileSystem::GetFileSystem(context), cache_directory);
+			} catch (const std::exception &e) {
+				throw std::runtime_error("Cannot create fit_cache_directory '" + cache_directory +
+				                         "': " + ErrorData(e).RawMessage());
+			}
+		}
+		ListFitFiles(context);
+		if (options.hive_partitioning) {
+			ListPartitions();
+		}
+	}
+
+	// Range of a record statistics column over all files, known once every file was decoded by the
+	// process in its current version. Computed once per scan.
+	bool GetRecordValueRange(ClientContext &context, idx_t statistics_index, FitValueRange &range) const {
+		std::lock_guard<std::mutex> guard(statistics_lock);
+		if (!statistics_loaded) {
+			auto &fs = FileSystem::GetFileSystem(context);
+			auto &index = GetFitFileStatistics();
+			for (auto &value_range : record_value_ranges) {
+				value_range = {true, false, 0, 0};
+			}
+			for (auto &file : files) {
+				FitFileKey key;
+				FitFileStatistics statistics;
+				bool known = GetFitFileKey(fs, file, key) && index.Get(key, statistics);
+				for (idx_t i = 0; i < FIT_RECORD_STATISTICS_COUNT; i++) {
+					auto &value_range = record_value_ranges[i];
+					value_range.known = value_range.known && known && statistics.values[i].known;
+					value_range.Merge(statistics.values[i]);
+				}
+			}
+			statistics_loaded = true;
+		}
+		range = record_value_ranges[statistics_index];
+		return range.known;
+	}
+
+	// Adds the hive partition columns to the columns of the table
+	void BindPartitionColumns(vector<LogicalType> &return_types, vector<string> &names) const {
+		for (idx_t i = 0; i < partition_names.size(); i++) {
+			if (std::find(names.begin(), names.end(), partition_names[i]) != names.end()) {
+				throw BinderException("Hive partition '%s' has the name of a column of the table",
+				                      partition_names[i]);
+			}
+			names.push_back(partition_names[i]);
+			return_types.push_back(partition_types[i]);
+		}
+	}
+
+private:
+	// Lists the files of every pattern through the file system of the client, so that remote and
+	// virtual file systems can be scanned and recursive patterns (archive/**/*.fit) are expanded
+	void ListFitFiles(ClientContext &context) {
+		auto &fs = FileSystem::GetFileSystem(context);
+		try {
+			if (patterns.empty()) {
+				throw std::runtime_error("File path cannot be empty");
+			}
+			for (auto &pattern : patterns) {
+				if (pattern.empty()) {
+					throw std::runtime_error("File path cannot be empty");
+				}
+				if (!FileSystem::HasGlob(pattern)) {
+					// A file named explicitly must exist, unlike the matches of a wildcard pattern
+					if (!fs.FileExists(pattern) && !fs.IsPipe(pattern)) {
+						throw std::runtime_error("Cannot open FIT file: " + pattern);
 					}
+					files.push_back(pattern);
+					continue;
+				}
+
+				// For wildcard patterns an empty list is a valid empty result
+				has_wildcards = true;
+				vector<string> matches;
+				for (auto &file : fs.GlobFiles(pattern, context, FileGlobOptions::ALLOW_EMPTY)) {
+					matches.push_back(file.path);
+				}
+				// Sort files for consistent ordering
+				std::sort(matches.begin(), matches.end());
+				files.insert(files.end(), matches.begin(), matches.end());
+			}
+		} catch (const std::exception &e) {
+			throw std::runtime_error("Error reading FIT files: " + string(e.what()));
+		}
+	}
+
+	// Partition columns are the keys of all files in order of appearance, a file without one of
+	// them has a NULL value
+	void ListPartitions() {
+		vector<vector<std::pair<string, string>>> file_partitions;
+		for (auto &file : files) {
+			file_partitions.push_back(GetFitFilePartitions(file));
+			for (auto &partition : file_partitions.back()) {
+				if (std::find(partition_names.begin(), partition_names.end(), partition.first) ==
+				    partition_names.end()) {
+					partition_names.push_back(partition.first);
 				}
+			}
+		}
 
-				// Apply activity types to records based on their file source
-				for (auto &record : fit_records) {
-					if (file_activity_types.find(record.file_source) != file_activity_types.end()) {
-						record.activity_type = file_activity_types[record.file_source];
+		vector<vector<const string *>> values(files.size(), vector<const string *>(partition_names.size()));
+		for (idx_t p = 0; p < partition_names.size(); p++) {
+			bool is_integer = true;
+			for (idx_t f = 0; f < files.size(); f++) {
+				for (auto &partition : file_partitions[f]) {
+					if (partition.first == partition_names[p] && !IsFitPartitionNull(partition.second)) {
+						values[f][p] = &partition.second;
+						is_integer = is_integer && IsFitPartitionInteger(partition.second);
 					}
 				}
 			}
+			partition_types.push_back(is_integer ? LogicalType::BIGINT : LogicalType::VARCHAR);
+		}
+
+		for (idx_t f = 0; f < files.size(); f++) {
+			partition_values.emplace_back();
+			for (idx_t p = 0; p < partition_names.size(); p++) {
+				auto value = values[f][p];
+				if (!value) {
+					partition_values.back().push_back(Value(partition_types[p]));
+				} else if (partition_types[p] == LogicalType::BIGINT) {
+					partition_values.back().push_back(Value::BIGINT(std::stoll(*value)));
+				} else {
+					partition_values.back().push_back(Value(*value));
+				}
+			}
+		}
+	}
+};
 
-			// Post-process: populate activities with session data
-			if (!fit_sessions.empty() && !fit_activities.empty()) {
-				// Group by file source and match sessions to activities
-				std::map<string, std::vector<FitSession *>> file_sessions;
-				std::map<string, std::vector<FitActivity *>> file_activities;
+// Decodes a FIT file into a collector. Decoding can pause every few records and resume later, so
+// that a scan emits the records of a file while it is decoded.
+class FitFileDecoder {
+public:
+	/**
+	 * @param buffer Contents of the file
+	 * @param file_path Path of the file, the file_source of its rows
+	 * @param plan What the file is decoded for
+	 * @param crc_check STRICT verifies the CRC here, DEFERRED once the file is decoded
+	 * @param interrupted Flag of the query, decoding stops when it is set
+	 * @throws std::runtime_error if the file is too large or its CRC fails
+	 */
+	FitFileDecoder(unique_ptr<FitFileBuffer> buffer_p, const string &file_path, const FitDecodePlan &plan,
+	               FitCrcCheck crc_check, optional_ptr<const std::atomic<bool>> interrupted)
+	    : collector(make_shared_ptr<FitDataCollector>(plan)), buffer(std::move(buffer_p)), crc_check(crc_check),
+	      check_crc(plan.check_crc), interrupted(interrupted), started(false), finished(false) {
+		if (buffer->GetSize() > NumericLimits<uint32_t>::Maximum()) {
+			throw std::runtime_error("FIT file is too large: " + file_path);
+		}
+
+		// Set current file in collector
+		collector->SetCurrentFile(file_path);
+		decode.SetRawMesgListener(collector.get());
+		decode.SetInterruptFlag(interrupted.get());
+		// Messages none of the listeners below reads are skipped without decoding their fields
+		decode.SetWantedMesgNums(plan.MesgNums());
+		if (plan.expand_components) {
+			for (auto &expanded : plan.ExpandedFields()) {
+				decode.SetExpandedFields(expanded.first, expanded.second);
+			}
+		} else {
+			decode.SuppressComponentExpansion();
+		}
 
-				for (auto &session : fit_sessions) {
-					file_sessions[session.file_source].push_back(&session);
+		// Add listeners for the message types the plan needs
+		if (plan.records) {
+			broadcaster.AddListener((fit::RecordMesgListener &)*collector);
+		}
+		if (plan.file_ids) {
+			broadcaster.AddListener((fit::FileIdMesgListener &)*collector);
+		}
+		if (plan.activities) {
+			broadcaster.AddListener((fit::ActivityMesgListener &)*collector);
+		}
+		if (plan.sessions) {
+			broadcaster.AddListener((fit::SessionMesgListener &)*collector);
+		}
+		if (plan.laps) {
+			broadcaster.AddListener((fit::LapMesgListener &)*collector);
+		}
+		if (plan.devices) {
+			broadcaster.AddListener((fit::DeviceInfoMesgListener &)*collector);
+		}
+		if (plan.events) {
+			broadcaster.AddListener((fit::EventMesgListener &)*collector);
+		}
+		if (plan.users) {
+			broadcaster.AddListener((fit::UserProfileMesgListener &)*collector);
+		}
+
+		// The CRC is checked over the whole buffer in one pass instead of byte by byte inside the decoder
+		decode.SuppressCrcCheck();
+
+		if (crc_check == FitCrcCheck::STRICT && !buffer->VerifyCrc()) {
+			throw std::runtime_error("FIT decode error: File CRC failed");
+		}
+	}
+
+	/**
+	 * Decodes the file further
+	 * @param max_records Records to decode before pausing, 0 to decode the rest of the file
+	 * @return True once the file is decoded completely, or up to the end of the timestamp range
+	 * @throws InterruptException if the query is cancelled
+	 * @throws std::exception if the file cannot be decoded
+	 */
+	bool Decode(idx_t max_records) {
+		collector->SetDecoder(&decode);
+		collector->SetRecordLimit(max_records > 0 ? collector->records.size() + max_records : 0);
+		bool done;
+		if (started) {
+			done = decode.Resume();
+		} else {
+			started = true;
+			done = decode.Read(buffer->GetData(), (FIT_UINT32)buffer->GetSize(), &broadcaster, &broadcaster,
+			                   nullptr);
+		}
+		collector->SetDecoder(nullptr);
+		if (interrupted && interrupted->load(std::memory_order_relaxed)) {
+			throw InterruptException();
+		}
+		if (!done && !collector->IsStopped()) {
+			// Paused after max_records
+			return false;
+		}
+
+		if (crc_check == FitCrcCheck::DEFERRED && !buffer->VerifyCrc()) {
+			throw std::runtime_error("FIT decode error: File CRC failed");
+		}
+		collector->crc_valid = crc_check != FitCrcCheck::OFF || (check_crc && buffer->VerifyCrc());
+		collector->FinishFile();
+		finished = true;
+		return true;
+	}
+
+	bool IsFinished() const {
+		return finished;
+	}
+
+	// False if the file may be truncated, decoding may then fail after some of its records
+	bool IsComplete() const {
+		return buffer->IsComplete();
+	}
+
+	const string &GetFilePath() const {
+		return collector->current_file_source;
+	}
+
+	shared_ptr<FitDataCollector> collector;
+
+private:
+	unique_ptr<FitFileBuffer> buffer;
+	fit::Decode decode;
+	fit::MesgBroadcaster broadcaster;
+	FitCrcCheck crc_check;
+	bool check_crc;
+	optional_ptr<const std::atomic<bool>> interrupted;
+	bool started;
+	bool finished;
+};
+
+// Rows of the tables with ids in a file, or in the files before it. The ids of a decoded file
+// number its rows from 0, the rows of the files before it are added when they are emitted so that
+// the ids of a scan number its rows as if its files were decoded one after the other.
+struct FitIdBase {
+	uint32_t sessions = 0;
+	uint32_t laps = 0;
+	uint32_t devices = 0;
+	uint32_t events = 0;
+	uint32_t users = 0;
+
+	void Add(const FitDataCollector &collector) {
+		sessions += (uint32_t)collector.sessions.size();
+		laps += (uint32_t)collector.laps.size();
+		devices += (uint32_t)collector.devices.size();
+		events += (uint32_t)collector.events.size();
+		users += (uint32_t)collector.users.size();
+	}
+
+	void Add(const FitIdBase &rows) {
+		sessions += rows.sessions;
+		laps += rows.laps;
+		devices += rows.devices;
+		events += rows.events;
+		users += rows.users;
+	}
+
+	// Number added to an id column, nullptr for other columns
+	const uint32_t *Get(const string &column_name) const {
+		if (column_name == "session_id") {
+			return &sessions;
+		} else if (column_name == "lap_id") {
+			return &laps;
+		} else if (column_name == "device_id") {
+			return &devices;
+		} else if (column_name == "event_id") {
+			return &events;
+		} else if (column_name == "user_id") {
+			return &users;
+		}
+		return nullptr;
+	}
+};
+
+// Adds the rows of the files before the file of the output to its id columns
+static void AddFitIdBase(const FitIdBase &base, const vector<string> &column_names, const vector<column_t> &column_ids,
+                         idx_t count, DataChunk &output) {
+	for (idx_t col = 0; col < column_ids.size(); col++) {
+		auto column_id = column_ids[col];
+		auto offset = column_id < column_names.size() ? base.Get(column_names[column_id]) : nullptr;
+		if (!offset || *offset == 0) {
+			continue;
+		}
+		auto data = FlatVector::GetData<uint32_t>(output.data[col]);
+		for (idx_t row = 0; row < count; row++) {
+			data[row] += *offset;
+		}
+	}
+}
+
+// Scan over the files of a table function. Files are handed out to the scanning threads one at
+// a time, each thread decodes its file into its own local state and emits its rows.
+struct FitScanGlobalState : public GlobalTableFunctionState {
+	vector<column_t> column_ids;
+	// What the projected columns are built from
+	FitDecodePlan plan;
+	// Index of the next file to hand out
+	std::atomic<idx_t> next_file {0};
+	idx_t file_count = 0;
+	// File system of the client the files are read through
+	optional_ptr<FileSystem> fs;
+	// The records of files only read for their records are emitted while the files are decoded
+	bool stream_records = false;
+	// Set when the query is cancelled, polled between files and while a file is decoded
+	optional_ptr<const std::atomic<bool>> interrupted;
+	// Files whose loading started or finished and their sizes, for the progress of the scan
+	mutable std::atomic<idx_t> files_started {0};
+	mutable std::atomic<idx_t> bytes_started {0};
+	mutable std::atomic<idx_t> files_finished {0};
+	mutable std::atomic<idx_t> bytes_finished {0};
+	// Set when an id column is projected from several files: the id base of a file is known once
+	// every file before it is loaded
+	bool number_ids = false;
+	std::mutex id_lock;
+	std::condition_variable id_bases_added;
+	vector<FitIdBase> file_rows;
+	vector<bool> file_loaded;
+	vector<FitIdBase> id_bases;
+	idx_t id_base_count = 0;
+
+	idx_t MaxThreads() const override {
+		return MaxValue<idx_t>(file_count, 1);
+	}
+
+	void Initialize(const FitTableFunctionData &bind_data) {
+		file_count = bind_data.files.size();
+		auto &table_type = bind_data.table_type;
+
+		// Only decode what the projected columns are built from: record fields are extracted
+		// per column, other messages are collected when a projected column depends on them
+		vector<string> columns;
+		for (auto column_id : column_ids) {
+			if (column_id < bind_data.column_names.size()) {
+				columns.push_back(bind_data.column_names[column_id]);
+			}
+		}
+		auto projected = [&](const char *name) {
+			return std::find(columns.begin(), columns.end(), name) != columns.end();
+		};
+		number_ids = file_count > 1 && std::any_of(columns.begin(), columns.end(), [](const string &column) {
+			             return FitIdBase().Get(column) != nullptr;
+		             });
+		if (number_ids) {
+			file_rows.resize(file_count);
+			file_loaded.resize(file_count, false);
+			id_bases.resize(file_count);
+		}
+		plan.records = table_type == "records";
+		plan.file_ids = table_type == "activities" || projected("activity_id");
+		plan.activities = table_type == "activities";
+		plan.sessions = table_type == "sessions" || table_type == "activities" ||
+		                (table_type == "records" && projected("activity_type")) ||
+		                (table_type == "laps" && projected("session_id"));
+		plan.laps = table_type == "laps";
+		plan.devices = table_type == "devices";
+		plan.events = table_type == "events";
+		plan.users = table_type == "users";
+		plan.expand_components = bind_data.options.expand_components;
+		if (plan.records) {
+			plan.timestamp_range = bind_data.timestamp_range;
+			if (plan.timestamp_range.IsSet()) {
+				// Records are filtered on their timestamp whether it is projected or not
+				columns.push_back(FIT_RECORD_COLUMNS[0].name);
+				plan.stop_after_range = !plan.sessions;
+			}
+			plan.record_filters = bind_data.record_filters;
+			for (auto &filter : plan.record_filters) {
+				columns.push_back(filter.column->name);
+			}
+			plan.record_fields = FitRecordFields(columns);
+		}
+		// Records take the sport of the sessions that follow them, files shared through the cache are
+		// decoded completely
+		stream_records = plan.records && !plan.sessions && bind_data.cache_memory_limit == 0 &&
+		                 bind_data.cache_directory.empty();
+	}
+
+	// Percentage of the bytes of the scan that are loaded, the size of the files not started yet
+	// is estimated from the files that are
+	double GetProgress() const {
+		idx_t started = files_started;
+		idx_t started_bytes = bytes_started;
+		if (file_count == 0) {
+			return 100.0;
+		}
+		if (started == 0 || started_bytes == 0) {
+			return 100.0 * (double)files_finished / (double)file_count;
+		}
+		double total_bytes = (double)started_bytes / (double)started * (double)file_count;
+		return MinValue(100.0 * (double)bytes_finished / total_bytes, 100.0);
+	}
+
+	void CheckInterrupted() const {
+		if (interrupted && interrupted->load(std::memory_order_relaxed)) {
+			throw InterruptException();
+		}
+	}
+
+	// Counts the rows of a file that was loaded, nullptr for a file that is skipped or failed
+	void AddFileRows(idx_t file, const FitDataCollector *collector) {
+		if (!number_ids) {
+			return;
+		}
+		std::lock_guard<std::mutex> guard(id_lock);
+		if (collector) {
+			file_rows[file].Add(*collector);
+		}
+		file_loaded[file] = true;
+		while (id_base_count < file_count && file_loaded[id_base_count]) {
+			if (id_base_count > 0) {
+				id_bases[id_base_count] = id_bases[id_base_count - 1];
+				id_bases[id_base_count].Add(file_rows[id_base_count - 1]);
+			}
+			id_base_count++;
+		}
+		id_bases_added.notify_all();
+	}
+
+	// Waits until every file before the file is loaded. Files are handed out in order, so each of
+	// them is being loaded by another thread.
+	FitIdBase GetIdBase(idx_t file) {
+		if (!number_ids) {
+			return FitIdBase();
+		}
+		std::unique_lock<std::mutex> guard(id_lock);
+		while (id_base_count <= file) {
+			id_bases_added.wait_for(guard, std::chrono::milliseconds(10));
+			CheckInterrupted();
+		}
+		return id_bases[file];
+	}
+
+	// Counts a file whose loading starts in the progress of the scan
+	// Returns false if the file has no key, its rows are then neither indexed nor shared
+	bool StartFile(const string &file_path, FitFileKey &key) const {
+		CheckInterrupted();
+		bool has_key = GetFitFileKey(*fs, file_path, key);
+		files_started++;
+		bytes_started += has_key ? key.size : 0;
+		return has_key;
+	}
+
+	void FinishFile(const FitFileKey *key) const {
+		files_finished++;
+		bytes_finished += key ? key->size : 0;
+	}
+
+	// Decoding stops at the first record past the timestamp range only in a file whose records an
+	// earlier complete decode found in time order, the records of any other file are all read
+	bool StopsAfterRange(const FitFileKey *key) const {
+		FitRecordSpan span;
+		return plan.stop_after_range && key && GetFitRecordSpans().Get(*key, span) && span.ordered;
+	}
+
+	// Files whose records are all outside of the timestamp range are not opened again
+	bool SkipFile(const FitFileKey &key) const {
+		FitRecordSpan span;
+		return plan.timestamp_range.IsSet() && GetFitRecordSpans().Get(key, span) &&
+		       (!span.has_records || !plan.timestamp_range.Overlaps(span.first, span.last));
+	}
+
+	// Remembers the record span and the statistics of a file decoded with the plan of the scan
+	static void IndexFile(const FitFileKey &key, const FitDataCollector &collector) {
+		FitRecordSpan span;
+		if (collector.GetRecordSpan(span)) {
+			GetFitRecordSpans().Put(key, span);
+		}
+		IndexFitFileStatistics(key, collector);
+	}
+
+	// Decoded rows of a file, shared with other scans through the file cache and the sidecars of
+	// the cache directory when they are enabled
+	// Returns nullptr if a file of a wildcard pattern could not be decoded and is skipped
+	shared_ptr<const FitDataCollector> LoadFile(const FitTableFunctionData &bind_data, const string &file_path) const {
+		FitFileKey key;
+		bool has_key = StartFile(file_path, key);
+		auto collector = LoadFile(bind_data, file_path, has_key ? &key : nullptr);
+		FinishFile(has_key ? &key : nullptr);
+		return collector;
+	}
+
+	shared_ptr<const FitDataCollector> LoadFile(const FitTableFunctionData &bind_data, const string &file_path,
+	                                            const FitFileKey *file_key) const {
+		bool use_memory = bind_data.cache_memory_limit > 0;
+		bool use_sidecar = !bind_data.cache_directory.empty();
+		if (!file_key) {
+			return DecodeFile(bind_data, plan, file_path, false);
+		}
+		auto &key = *file_key;
+		if (SkipFile(key)) {
+			return nullptr;
+		}
+		if ((!use_memory && !use_sidecar) || !plan.expand_components) {
+			// Only what the scan needs is decoded, the file is not shared. Shared files are
+			// decoded with component expansion.
+			auto decoded = DecodeFile(bind_data, plan, file_path, StopsAfterRange(&key));
+			if (decoded) {
+				IndexFile(key, *decoded);
+			}
+			return std::move(decoded);
+		}
+
+		auto &cache = GetFitFileCache();
+		shared_ptr<const FitDataCollector> collector;
+		if (use_memory) {
+			collector = cache.Get(key);
+		}
+		if (!collector) {
+			auto sidecar_path = use_sidecar ? GetFitSidecarPath(bind_data.cache_directory, file_path) : string();
+			if (use_sidecar) {
+				collector = ReadFitSidecar(*fs, sidecar_path, key);
+			}
+			if (!collector) {
+				// Shared files are decoded completely, so that scans of any table can use them
+				auto decoded = DecodeFile(bind_data, FitDecodePlan::All(), file_path, false);
+				if (!decoded) {
+					return nullptr;
 				}
-				for (auto &activity : fit_activities) {
-					file_activities[activity.file_source].push_back(&activity);
+				FitRecordSpan span;
+				if (decoded->GetRecordSpan(span)) {
+					GetFitRecordSpans().Put(key, span);
 				}
+				if (use_sidecar) {
+					WriteFitSidecar(sidecar_path, key, *decoded);
+				}
+				collector = std::move(decoded);
+			}
+			if (use_memory) {
+				cache.Put(key, collector, collector->GetMemoryUsage());
+			}
+		}
+		IndexFitFileStatistics(key, *collector);
+		if (!collector->crc_valid && bind_data.options.crc_check != FitCrcCheck::OFF) {
+			// Shared by a scan that does not check the CRC
+			if (!bind_data.has_wildcards) {
+				throw std::runtime_error("Error reading FIT file '" + file_path +
+				                         "': FIT decode error: File CRC failed");
+			}
+			return nullptr;
+		}
+		return collector;
+	}
 
-				// Match sessions to activities within each file
-				for (const auto &file_pair : file_activities) {
-					const string &file_source = file_pair.first;
-					auto &activities = file_pair.second;
-
-					if (file_sessions.find(file_source) != file_sessions.end() && !file_sessions[file_source].empty() &&
-					    !activities.empty()) {
-
-						auto &session = *file_sessions[file_source][0]; // Use first session
-						auto &activity = *activities[0];                // Use first activity
-
-						// Copy sport information
-						activity.sport = session.sport;
-						activity.sub_sport = session.sub_sport;
-
-						// Copy performance data
-						activity.total_distance = session.total_distance;
-						activity.total_elapsed_time = session.total_elapsed_time;
-						activity.total_calories = session.total_calories;
-						activity.avg_heart_rate = session.avg_heart_rate;
-						activity.max_heart_rate = session.max_heart_rate;
-						activity.avg_speed = session.avg_speed;
-						activity.max_speed = session.max_speed;
-						activity.avg_power = session.avg_power;
-						activity.max_power = session.max_power;
-						activity.avg_cadence = session.avg_cadence;
-						activity.max_cadence = session.max_cadence;
-						activity.total_ascent = session.total_ascent;
-						activity.total_descent = session.total_descent;
-
-						// Copy start time if not already set
-						if (activity.start_time.value == 0 && session.start_time.value != 0) {
-							activity.start_time = session.start_time;
-						}
+	// Returns nullptr if a file of a wildcard pattern could not be decoded and is skipped
+	// Throws an InterruptException if the query is cancelled while the file is decoded
+	shared_ptr<FitDataCollector> DecodeFile(const FitTableFunctionData &bind_data, const FitDecodePlan &plan,
+	                                        const string &file_path, bool stop_after_range) const {
+		auto decoder = OpenFile(bind_data, plan, file_path, bind_data.options.crc_check, stop_after_range);
+		if (!decoder || !DecodeRecords(bind_data, *decoder, 0)) {
+			return nullptr;
+		}
+		return decoder->collector;
+	}
+
+	// Loads a file to decode it with the plan, stopping at the first record past the timestamp
+	// range with stop_after_range
+	// Returns nullptr if a file of a wildcard pattern could not be opened and is skipped
+	unique_ptr<FitFileDecoder> OpenFile(const FitTableFunctionData &bind_data, const FitDecodePlan &plan,
+	                                    const string &file_path, FitCrcCheck crc_check,
+	                                    bool stop_after_range) const {
+		// Load the whole file so the decoder works on one contiguous span
+		unique_ptr<FitFileBuffer> buffer;
+		try {
+			buffer = make_uniq<FitFileBuffer>(*fs, file_path);
+		} catch (const std::exception &) {
+			if (!bind_data.has_wildcards) {
+				// For single files, this is an error
+				throw;
+			}
+			// For wildcard patterns, skip files that can't be opened
+			return nullptr;
+		}
+		try {
+			auto decoder = make_uniq<FitFileDecoder>(std::move(buffer), file_path, plan, crc_check, interrupted);
+			if (stop_after_range) {
+				decoder->collector->StopAfterRange();
+			}
+			return decoder;
+		} catch (const std::exception &e) {
+			HandleDecodeError(bind_data, file_path, e);
+			return nullptr;
+		}
+	}
+
+	// Decodes a file further, up to max_records more records or to its end when 0
+	// Returns false if a file of a wildcard pattern fails to decode and is skipped
+	bool DecodeRecords(const FitTableFunctionData &bind_data, FitFileDecoder &decoder, idx_t max_records) const {
+		try {
+			decoder.Decode(max_records);
+			return true;
+		} catch (const InterruptException &) {
+			throw;
+		} catch (const std::exception &e) {
+			HandleDecodeError(bind_data, decoder.GetFilePath(), e);
+			return false;
+		}
+	}
+
+	static void HandleDecodeError(const FitTableFunctionData &bind_data, const string &file_path,
+	                              const std::exception &e) {
+		if (!bind_data.has_wildcards) {
+			// For single files, propagate the error
+			throw std::runtime_error("Error reading FIT file '" + file_path + "': " + string(e.what()));
+		}
+		// For wildcard patterns, continue with next file if one fails
+	}
+};
+
+// Rows of the file a scanning thread is emitting
+struct FitScanLocalState : public LocalTableFunctionState {
+	shared_ptr<const FitDataCollector> collector;
+	// Decoder of a file whose records are emitted while it is decoded, nullptr once it is decoded
+	unique_ptr<FitFileDecoder> decoder;
+	FitFileKey file_key;
+	bool has_file_key = false;
+	idx_t file_index = 0;
+	FitIdBase id_base;
+	idx_t current_row = 0;
+
+	// Loads the next unclaimed file that can be read. Files of a scan that streams its records are
+	// only opened, DecodeRecords decodes their records as they are scanned.
+	// Returns false once all files have been handed out
+	bool DecodeNextFile(const FitTableFunctionData &bind_data, FitScanGlobalState &global_state) {
+		collector.reset();
+		decoder.reset();
+		current_row = 0;
+		// File claimed whose rows are not counted yet, counted as empty if it fails to load
+		idx_t uncounted_file = DConstants::INVALID_INDEX;
+		try {
+			while (true) {
+				idx_t file = global_state.next_file++;
+				if (file >= global_state.file_count) {
+					return false;
+				}
+				auto &file_path = bind_data.files[file];
+				if (!global_state.stream_records) {
+					uncounted_file = file;
+					auto file_collector = global_state.LoadFile(bind_data, file_path);
+					uncounted_file = DConstants::INVALID_INDEX;
+					global_state.AddFileRows(file, file_collector.get());
+					if (file_collector) {
+						collector = std::move(file_collector);
+						file_index = file;
+						id_base = global_state.GetIdBase(file);
+						return true;
 					}
+					continue;
 				}
+
+				has_file_key = global_state.StartFile(file_path, file_key);
+				if (!has_file_key || !global_state.SkipFile(file_key)) {
+					// Records are emitted before the end of the file, its CRC is verified first
+					auto crc_check = bind_data.options.crc_check == FitCrcCheck::OFF ? FitCrcCheck::OFF
+					                                                                 : FitCrcCheck::STRICT;
+					decoder = global_state.OpenFile(bind_data, global_state.plan, file_path, crc_check,
+					                                global_state.StopsAfterRange(has_file_key ? &file_key : nullptr));
+				}
+				if (decoder && bind_data.has_wildcards && !decoder->IsComplete() &&
+				    !global_state.DecodeRecords(bind_data, *decoder, 0)) {
+					// Files of a pattern that fail to decode are skipped: a file that may be truncated is
+					// decoded completely before its records are emitted
+					decoder.reset();
+				}
+				if (decoder) {
+					collector = decoder->collector;
+					file_index = file;
+					return true;
+				}
+				global_state.FinishFile(has_file_key ? &file_key : nullptr);
 			}
+		} catch (const InterruptException &) {
+			if (uncounted_file != DConstants::INVALID_INDEX) {
+				global_state.AddFileRows(uncounted_file, nullptr);
+			}
+			throw;
+		} catch (const std::exception &e) {
+			// The threads waiting for the id base of a later file stop waiting for this one
+			if (uncounted_file != DConstants::INVALID_INDEX) {
+				global_state.AddFileRows(uncounted_file, nullptr);
+			}
+			throw std::runtime_error("Error reading FIT files: " + string(e.what()));
+		}
+	}
 
+	// Decodes the next vector of records of the file being streamed. Rows decoded before an error
+	// in a file of a wildcard pattern are kept.
+	void DecodeRecords(const FitTableFunctionData &bind_data, FitScanGlobalState &global_state) {
+		try {
+			bool decoded =
+			    decoder->IsFinished() || global_state.DecodeRecords(bind_data, *decoder, STANDARD_VECTOR_SIZE);
+			if (decoded && !decoder->IsFinished()) {
+				return;
+			}
+			if (decoded && has_file_key) {
+				global_state.IndexFile(file_key, *decoder->collector);
+			}
+			global_state.FinishFile(has_file_key ? &file_key : nullptr);
+			decoder.reset();
+		} catch (const InterruptException &) {
+			throw;
 		} catch (const std::exception &e) {
 			throw std::runtime_error("Error reading FIT files: " + string(e.what()));
 		}
 	}
 };
 
-static unique_ptr<FunctionData> FitTableBind(ClientContext &context, TableFunctionBindInput &input,
-                                             vector<LogicalType> &return_types, vector<string> &names) {
-	// Get the input parameter (file path)
-	auto file_path = input.inputs[0].GetValue<string>();
-
-	// Define the FIT data schema with grouped names and types
-	struct ColumnDef {
-		string name;
-		LogicalType type;
-	};
-
-	vector<ColumnDef> columns = {// Basic timestamp and location
-	                             {"timestamp", LogicalType::TIMESTAMP_TZ},
-	                             {"latitude", LogicalType::DOUBLE},
-	                             {"longitude", LogicalType::DOUBLE},
-	                             {"altitude", LogicalType::DOUBLE},
-	                             {"enhanced_altitude", LogicalType::DOUBLE},
-
-	                             // Speed and distance
-	                             {"distance", LogicalType::DOUBLE},
-	                             {"speed", LogicalType::DOUBLE},
-	                             {"enhanced_speed", LogicalType::DOUBLE},
-	                             {"vertical_speed", LogicalType::DOUBLE},
-
-	                             // Power metrics
-	                             {"power", LogicalType::USMALLINT},                        // uint16_t -> USMALLINT
-	                             {"motor_power", LogicalType::USMALLINT},                  // uint16_t -> USMALLINT
-	                             {"accumulated_power", LogicalType::UINTEGER},             // uint32_t -> UINTEGER
-	                             {"compressed_accumulated_power", LogicalType::USMALLINT}, // uint16_t -> USMALLINT
-
-	                             // Heart rate and physiological data
-	                             {"heart_rate", LogicalType::UTINYINT}, // uint8_t -> UTINYINT (corrected)
-	                             {"total_hemoglobin_conc", LogicalType::DOUBLE},
-	                             {"total_hemoglobin_conc_min", LogicalType::DOUBLE},
-	                             {"total_hemoglobin_conc_max", LogicalType::DOUBLE},
-	                             {"saturated_hemoglobin_percent", LogicalType::DOUBLE},
-	                             {"saturated_hemoglobin_percent_min", LogicalType::DOUBLE},
-	                             {"saturated_hemoglobin_percent_max", LogicalType::DOUBLE},
-
-	                             // Cadence metrics
-	                             {"cadence", LogicalType::UTINYINT}, // uint8_t -> UTINYINT (corrected)
-	                             {"cadence256", LogicalType::DOUBLE},
-	                             {"fractional_cadence", LogicalType::DOUBLE},
-
-	                             // Temperature
-	                             {"temperature", LogicalType::TINYINT}, // int8_t -> TINYINT (corrected)
-	                             {"core_temperature", LogicalType::DOUBLE},
-
-	                             // Cycling metrics
-	                             {"grade", LogicalType::DOUBLE},
-	                             {"resistance", LogicalType::USMALLINT},        // uint16_t -> USMALLINT
-	                             {"left_right_balance", LogicalType::UTINYINT}, // uint8_t -> UTINYINT (corrected)
-	                             {"left_torque_effectiveness", LogicalType::DOUBLE},
-	                             {"right_torque_effectiveness", LogicalType::DOUBLE},
-	                             {"left_pedal_smoothness", LogicalType::DOUBLE},
-	                             {"right_pedal_smoothness", LogicalType::DOUBLE},
-	                             {"combined_pedal_smoothness", LogicalType::DOUBLE},
-	                             {"left_pco", LogicalType::TINYINT},  // int8_t -> TINYINT
-	                             {"right_pco", LogicalType::TINYINT}, // int8_t -> TINYINT
-
-	                             // Running metrics
-	                             {"vertical_oscillation", LogicalType::DOUBLE},
-	                             {"stance_time_percent", LogicalType::DOUBLE},
-	                             {"stance_time", LogicalType::DOUBLE},
-	                             {"stance_time_balance", LogicalType::DOUBLE},
-	                             {"step_length", LogicalType::DOUBLE},
-	                             {"vertical_ratio", LogicalType::DOUBLE},
-
-	                             // Cycling/Swimming specific
-	                             {"cycle_length", LogicalType::DOUBLE},
-	                             {"cycle_length16", LogicalType::DOUBLE},
-	                             {"cycles", LogicalType::UTINYINT},
-	                             {"total_cycles", LogicalType::UINTEGER}, // uint32_t -> UINTEGER
-
-	                             // Navigation and course
-	                             {"time_from_course", LogicalType::DOUBLE},
-	                             {"gps_accuracy", LogicalType::UTINYINT},
-
-	                             // Energy and calories
-	                             {"calories", LogicalType::USMALLINT}, // uint16_t -> USMALLINT (corrected)
-
-	                             // Zones and training
-	                             {"zone", LogicalType::UTINYINT},
-	                             {"activity_type", LogicalType::VARCHAR},
-	                             {"stroke_type", LogicalType::VARCHAR},
-
-	                             // Advanced metrics
-	                             {"time128", LogicalType::DOUBLE},
-	                             {"grit", LogicalType::DOUBLE},
-	                             {"flow", LogicalType::DOUBLE},
-	                             {"current_stress", LogicalType::DOUBLE},
-
-	                             // E-bike specific
-	                             {"ebike_travel_range", LogicalType::USMALLINT}, // uint16_t -> USMALLINT
-	                             {"ebike_battery_level", LogicalType::UTINYINT},
-	                             {"ebike_assist_mode", LogicalType::UTINYINT},
-	                             {"ebike_assist_level_percent", LogicalType::UTINYINT},
-	                             {"battery_soc", LogicalType::DOUBLE},
-
-	                             // Sports specific
-	                             {"ball_speed", LogicalType::DOUBLE},
-
-	                             // Diving/Swimming specific
-	                             {"absolute_pressure", LogicalType::UINTEGER}, // uint32_t -> UINTEGER
-	                             {"depth", LogicalType::DOUBLE},
-	                             {"next_stop_depth", LogicalType::DOUBLE},
-	                             {"next_stop_time", LogicalType::UINTEGER},  // uint32_t -> UINTEGER
-	                             {"time_to_surface", LogicalType::UINTEGER}, // uint32_t -> UINTEGER
-	                             {"ndl_time", LogicalType::UINTEGER},        // uint32_t -> UINTEGER
-	                             {"cns_load", LogicalType::UTINYINT},
-	                             {"n2_load", LogicalType::USMALLINT},           // uint16_t -> USMALLINT
-	                             {"air_time_remaining", LogicalType::UINTEGER}, // uint32_t -> UINTEGER
-	                             {"pressure_sac", LogicalType::DOUBLE},
-	                             {"volume_sac", LogicalType::DOUBLE},
-	                             {"rmv", LogicalType::DOUBLE},
-	                             {"ascent_rate", LogicalType::DOUBLE},
-	                             {"po2", LogicalType::DOUBLE},
-
-	                             // Respiratory
-	                             {"respiration_rate", LogicalType::UTINYINT},
-	                             {"enhanced_respiration_rate", LogicalType::DOUBLE},
-
-	                             // Device info
-	                             {"device_index", LogicalType::UTINYINT},
-
-	                             // File source
-	                             {"file_source", LogicalType::VARCHAR}};
-
-	// Extract names and types from the column definitions
-	for (const auto &col : columns) {
-		names.push_back(col.name);
-		return_types.push_back(col.type);
-	}
-
-	return make_uniq<FitTableFunctionData>(file_path, "records", &context);
+static unique_ptr<GlobalTableFunctionState> FitInitGlobal(ClientContext &context, TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<FitTableFunctionData>();
+	auto result = make_uniq<FitScanGlobalState>();
+	result->column_ids = input.column_ids;
+	result->fs = FileSystem::GetFileSystem(context);
+	result->interrupted = &context.interrupted;
+	result->Initialize(bind_data);
+	return std::move(result);
 }
 
-static void FitTableFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &data = (FitTableFunctionData &)*data_p.bind_data;
+static unique_ptr<LocalTableFunctionState> FitInitLocal(ExecutionContext &context, TableFunctionInitInput &input,
+                                                        GlobalTableFunctionState *global_state) {
+	return make_uniq<FitScanLocalState>();
+}
 
-	idx_t remaining_rows = data.fit_records.size() - data.current_row;
-	idx_t rows_to_output = MinValue<idx_t>(remaining_rows, STANDARD_VECTOR_SIZE);
+// Replaces the references to partition columns by the partition values of a file
+static void BindFitPartitionValues(unique_ptr<Expression> &expression, const LogicalGet &get,
+                                   const FitTableFunctionData &bind_data, idx_t file_index) {
+	if (expression->GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &column_ref = expression->Cast<BoundColumnRefExpression>();
+		auto column_id = get.GetColumnIds()[column_ref.binding.column_index].GetPrimaryIndex();
+		auto &value = bind_data.partition_values[file_index][column_id - bind_data.column_names.size()];
+		expression = make_uniq<BoundConstantExpression>(value);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(*expression, [&](unique_ptr<Expression> &child) {
+		BindFitPartitionValues(child, get, bind_data, file_index);
+	});
+}
 
-	if (rows_to_output == 0) {
-		output.SetCardinality(0);
+// Prunes the files whose partition values fail a filter on partition columns only, before any of
+// them is opened
+static void PruneFitPartitions(ClientContext &context, const LogicalGet &get, FitTableFunctionData &bind_data,
+                               unique_ptr<Expression> &filter) {
+	auto first_partition = bind_data.column_names.size();
+	auto &column_ids = get.GetColumnIds();
+	bool partitions_only = true;
+	bool has_columns = false;
+	ExpressionIterator::EnumerateExpression(filter, [&](Expression &child) {
+		if (child.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			return;
+		}
+		auto &binding = child.Cast<BoundColumnRefExpression>().binding;
+		has_columns = true;
+		if (binding.table_index != get.table_index || binding.column_index >= column_ids.size()) {
+			partitions_only = false;
+			return;
+		}
+		auto column_id = column_ids[binding.column_index].GetPrimaryIndex();
+		partitions_only = partitions_only && column_id >= first_partition &&
+		                  column_id < first_partition + bind_data.partition_names.size();
+	});
+	if (!has_columns || !partitions_only) {
 		return;
 	}
 
-	// Fill the output chunk with FIT data
-	for (idx_t row = 0; row < rows_to_output; row++) {
-		const auto &fit_record = data.fit_records[data.current_row + row];
-		idx_t col = 0;
-
-		// Basic timestamp and location
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(fit_record.timestamp));
-
-		output.SetValue(col++, row, fit_record.latitude != 0.0 ? Value::DOUBLE(fit_record.latitude) : Value());
-		output.SetValue(col++, row, fit_record.longitude != 0.0 ? Value::DOUBLE(fit_record.longitude) : Value());
-		output.SetValue(col++, row, fit_record.altitude != 0.0 ? Value::DOUBLE(fit_record.altitude) : Value());
-		output.SetValue(col++, row,
-		                fit_record.enhanced_altitude != 0.0 ? Value::DOUBLE(fit_record.enhanced_altitude) : Value());
-
-		// Speed and distance
-		output.SetValue(col++, row, fit_record.distance > 0.0 ? Value::DOUBLE(fit_record.distance) : Value());
-		output.SetValue(col++, row, fit_record.speed > 0.0 ? Value::DOUBLE(fit_record.speed) : Value());
-		output.SetValue(col++, row,
-		                fit_record.enhanced_speed > 0.0 ? Value::DOUBLE(fit_record.enhanced_speed) : Value());
-		output.SetValue(col++, row,
-		                fit_record.vertical_speed != 0.0 ? Value::DOUBLE(fit_record.vertical_speed) : Value());
-
-		// Power metrics - corrected to use proper unsigned types
-		output.SetValue(col++, row, fit_record.power > 0 ? Value::USMALLINT(fit_record.power) : Value());
-		output.SetValue(col++, row, fit_record.motor_power > 0 ? Value::USMALLINT(fit_record.motor_power) : Value());
-		output.SetValue(col++, row,
-		                fit_record.accumulated_power > 0 ? Value::UINTEGER(fit_record.accumulated_power) : Value());
-		output.SetValue(col++, row,
-		                fit_record.compressed_accumulated_power > 0
-		                    ? Value::USMALLINT(fit_record.compressed_accumulated_power)
-		                    : Value());
-
-		// Heart rate and physiological data - corrected to use UTINYINT for heart_rate
-		output.SetValue(col++, row, fit_record.heart_rate > 0 ? Value::UTINYINT(fit_record.heart_rate) : Value());
-		output.SetValue(col++, row,
-		                fit_record.total_hemoglobin_conc > 0.0 ? Value::DOUBLE(fit_record.total_hemoglobin_conc)
-		                                                       : Value());
-		output.SetValue(col++, row,
-		                fit_record.total_hemoglobin_conc_min > 0.0 ? Value::DOUBLE(fit_record.total_hemoglobin_conc_min)
-		                                                           : Value());
-		output.SetValue(col++, row,
-		                fit_record.total_hemoglobin_conc_max > 0.0 ? Value::DOUBLE(fit_record.total_hemoglobin_conc_max)
-		                                                           : Value());
-		output.SetValue(col++, row,
-		                fit_record.saturated_hemoglobin_percent > 0.0
-		                    ? Value::DOUBLE(fit_record.saturated_hemoglobin_percent)
-		                    : Value());
-		output.SetValue(col++, row,
-		                fit_record.saturated_hemoglobin_percent_min > 0.0
-		                    ? Value::DOUBLE(fit_record.saturated_hemoglobin_percent_min)
-		                    : Value());
-		output.SetValue(col++, row,
-		                fit_record.saturated_hemoglobin_percent_max > 0.0
-		                    ? Value::DOUBLE(fit_record.saturated_hemoglobin_percent_max)
-		                    : Value());
-
-		// Cadence metrics - corrected to use UTINYINT for cadence
-		output.SetValue(col++, row, fit_record.cadence > 0 ? Value::UTINYINT(fit_record.cadence) : Value());
-		output.SetValue(col++, row, fit_record.cadence256 > 0.0 ? Value::DOUBLE(fit_record.cadence256) : Value());
-		output.SetValue(col++, row,
-		                fit_record.fractional_cadence > 0.0 ? Value::DOUBLE(fit_record.fractional_cadence) : Value());
-
-		// Temperature - corrected to use TINYINT for temperature
-		output.SetValue(col++, row, fit_record.temperature != 0 ? Value::TINYINT(fit_record.temperature) : Value());
-		output.SetValue(col++, row,
-		                fit_record.core_temperature != 0.0 ? Value::DOUBLE(fit_record.core_temperature) : Value());
-
-		// Cycling metrics - corrected types
-		output.SetValue(col++, row, fit_record.grade != 0.0 ? Value::DOUBLE(fit_record.grade) : Value());
-		output.SetValue(col++, row, fit_record.resistance > 0 ? Value::USMALLINT(fit_record.resistance) : Value());
-		output.SetValue(col++, row,
-		                fit_record.left_right_balance > 0 ? Value::UTINYINT(fit_record.left_right_balance) : Value());
-		output.SetValue(col++, row,
-		                fit_record.left_torque_effectiveness != 0.0
-		                    ? Value::DOUBLE(fit_record.left_torque_effectiveness)
-		                    : Value());
-		output.SetValue(col++, row,
-		                fit_record.right_torque_effectiveness != 0.0
-		                    ? Value::DOUBLE(fit_record.right_torque_effectiveness)
-		                    : Value());
-		output.SetValue(col++, row,
-		                fit_record.left_pedal_smoothness != 0.0 ? Value::DOUBLE(fit_record.left_pedal_smoothness)
-		                                                        : Value());
-		output.SetValue(col++, row,
-		                fit_record.right_pedal_smoothness != 0.0 ? Value::DOUBLE(fit_record.right_pedal_smoothness)
-		                                                         : Value());
-		output.SetValue(col++, row,
-		                fit_record.combined_pedal_smoothness != 0.0
-		                    ? Value::DOUBLE(fit_record.combined_pedal_smoothness)
-		                    : Value());
-		output.SetValue(col++, row, fit_record.left_pco != 0 ? Value::TINYINT(fit_record.left_pco) : Value());
-		output.SetValue(col++, row, fit_record.right_pco != 0 ? Value::TINYINT(fit_record.right_pco) : Value());
-
-		// Running metrics
-		output.SetValue(col++, row,
-		                fit_record.vertical_oscillation > 0.0 ? Value::DOUBLE(fit_record.vertical_oscillation)
-		                                                      : Value());
-		output.SetValue(col++, row,
-		                fit_record.stance_time_percent > 0.0 ? Value::DOUBLE(fit_record.stance_time_percent) : Value());
-		output.SetValue(col++, row, fit_record.stance_time > 0.0 ? Value::DOUBLE(fit_record.stance_time) : Value());
-		output.SetValue(col++, row,
-		                fit_record.stance_time_balance > 0.0 ? Value::DOUBLE(fit_record.stance_time_balance) : Value());
-		output.SetValue(col++, row, fit_record.step_length > 0.0 ? Value::DOUBLE(fit_record.step_length) : Value());
-		output.SetValue(col++, row,
-		                fit_record.vertical_ratio > 0.0 ? Value::DOUBLE(fit_record.vertical_ratio) : Value());
-
-		// Cycling/Swimming specific
-		output.SetValue(col++, row, fit_record.cycle_length > 0.0 ? Value::DOUBLE(fit_record.cycle_length) : Value());
-		output.SetValue(col++, row,
-		                fit_record.cycle_length16 > 0.0 ? Value::DOUBLE(fit_record.cycle_length16) : Value());
-		output.SetValue(col++, row, fit_record.cycles > 0 ? Value::UTINYINT(fit_record.cycles) : Value());
-		output.SetValue(col++, row, fit_record.total_cycles > 0 ? Value::UINTEGER(fit_record.total_cycles) : Value());
-
-		// Navigation and course
-		output.SetValue(col++, row,
-		                fit_record.time_from_course != 0.0 ? Value::DOUBLE(fit_record.time_from_course) : Value());
-		output.SetValue(col++, row, fit_record.gps_accuracy > 0 ? Value::UTINYINT(fit_record.gps_accuracy) : Value());
-
-		// Energy and calories - corrected to use USMALLINT
-		output.SetValue(col++, row, fit_record.calories > 0 ? Value::USMALLINT(fit_record.calories) : Value());
-
-		// Zones and training
-		output.SetValue(col++, row, fit_record.zone > 0 ? Value::UTINYINT(fit_record.zone) : Value());
-		output.SetValue(col++, row, Value(fit_record.activity_type));
-		output.SetValue(col++, row, Value(fit_record.stroke_type));
-
-		// Advanced metrics
-		output.SetValue(col++, row, fit_record.time128 != 0.0 ? Value::DOUBLE(fit_record.time128) : Value());
-		output.SetValue(col++, row, fit_record.grit != 0.0 ? Value::DOUBLE(fit_record.grit) : Value());
-		output.SetValue(col++, row, fit_record.flow != 0.0 ? Value::DOUBLE(fit_record.flow) : Value());
-		output.SetValue(col++, row,
-		                fit_record.current_stress != 0.0 ? Value::DOUBLE(fit_record.current_stress) : Value());
-
-		// E-bike specific - corrected to use USMALLINT for ebike_travel_range
-		output.SetValue(col++, row,
-		                fit_record.ebike_travel_range > 0 ? Value::USMALLINT(fit_record.ebike_travel_range) : Value());
-		output.SetValue(col++, row,
-		                fit_record.ebike_battery_level > 0 ? Value::UTINYINT(fit_record.ebike_battery_level) : Value());
-		output.SetValue(col++, row,
-		                fit_record.ebike_assist_mode > 0 ? Value::UTINYINT(fit_record.ebike_assist_mode) : Value());
-		output.SetValue(col++, row,
-		                fit_record.ebike_assist_level_percent > 0
-		                    ? Value::UTINYINT(fit_record.ebike_assist_level_percent)
-		                    : Value());
-		output.SetValue(col++, row, fit_record.battery_soc > 0.0 ? Value::DOUBLE(fit_record.battery_soc) : Value());
-
-		// Sports specific
-		output.SetValue(col++, row, fit_record.ball_speed > 0.0 ? Value::DOUBLE(fit_record.ball_speed) : Value());
-
-		// Diving/Swimming specific - corrected to use proper unsigned types
-		output.SetValue(col++, row,
-		                fit_record.absolute_pressure > 0 ? Value::UINTEGER(fit_record.absolute_pressure) : Value());
-		output.SetValue(col++, row, fit_record.depth > 0.0 ? Value::DOUBLE(fit_record.depth) : Value());
-		output.SetValue(col++, row,
-		                fit_record.next_stop_depth > 0.0 ? Value::DOUBLE(fit_record.next_stop_depth) : Value());
-		output.SetValue(col++, row,
-		                fit_record.next_stop_time > 0 ? Value::UINTEGER(fit_record.next_stop_time) : Value());
-		output.SetValue(col++, row,
-		                fit_record.time_to_surface > 0 ? Value::UINTEGER(fit_record.time_to_surface) : Value());
-		output.SetValue(col++, row, fit_record.ndl_time > 0 ? Value::UINTEGER(fit_record.ndl_time) : Value());
-		output.SetValue(col++, row, fit_record.cns_load > 0 ? Value::UTINYINT(fit_record.cns_load) : Value());
-		output.SetValue(col++, row, fit_record.n2_load > 0 ? Value::USMALLINT(fit_record.n2_load) : Value());
-		output.SetValue(col++, row,
-		                fit_record.air_time_remaining > 0 ? Value::UINTEGER(fit_record.air_time_remaining) : Value());
-		output.SetValue(col++, row, fit_record.pressure_sac > 0.0 ? Value::DOUBLE(fit_record.pressure_sac) : Value());
-		output.SetValue(col++, row, fit_record.volume_sac > 0.0 ? Value::DOUBLE(fit_record.volume_sac) : Value());
-		output.SetValue(col++, row, fit_record.rmv > 0.0 ? Value::DOUBLE(fit_record.rmv) : Value());
-		output.SetValue(col++, row, fit_record.ascent_rate != 0.0 ? Value::DOUBLE(fit_record.ascent_rate) : Value());
-		output.SetValue(col++, row, fit_record.po2 > 0.0 ? Value::DOUBLE(fit_record.po2) : Value());
-
-		// Respiratory
-		output.SetValue(col++, row,
-		                fit_record.respiration_rate > 0 ? Value::UTINYINT(fit_record.respiration_rate) : Value());
-		output.SetValue(col++, row,
-		                fit_record.enhanced_respiration_rate > 0.0 ? Value::DOUBLE(fit_record.enhanced_respiration_rate)
-		                                                           : Value());
-
-		// Device info
-		output.SetValue(col++, row, fit_record.device_index > 0 ? Value::UTINYINT(fit_record.device_index) : Value());
-
-		// File source
-		output.SetValue(col++, row, !fit_record.file_source.empty() ? Value(fit_record.file_source) : Value());
+	vector<string> files;
+	vector<vector<Value>> partition_values;
+	for (idx_t file_index = 0; file_index < bind_data.files.size(); file_index++) {
+		auto expression = filter->Copy();
+		BindFitPartitionValues(expression, get, bind_data, file_index);
+		Value result;
+		if (ExpressionExecutor::TryEvaluateScalar(context, *expression, result) &&
+		    (result.IsNull() || !BooleanValue::Get(result.DefaultCastAs(LogicalType::BOOLEAN)))) {
+			continue;
+		}
+		files.push_back(std::move(bind_data.files[file_index]));
+		partition_values.push_back(std::move(bind_data.partition_values[file_index]));
 	}
+	bind_data.files = std::move(files);
+	bind_data.partition_values = std::move(partition_values);
+}
 
-	output.SetCardinality(rows_to_output);
-	data.current_row += rows_to_output;
+// Column of fit_records an expression refers to, nullptr for other expressions and partition columns
+static const FitRecordColumn *GetFitRecordColumn(const LogicalGet &get, const Expression &expression) {
+	if (expression.GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+		return nullptr;
+	}
+	auto &binding = expression.Cast<BoundColumnRefExpression>().binding;
+	auto &column_ids = get.GetColumnIds();
+	if (binding.table_index != get.table_index || binding.column_index >= column_ids.size()) {
+		return nullptr;
+	}
+	auto column_id = column_ids[binding.column_index].GetPrimaryIndex();
+	return column_id < FIT_RECORD_COLUMN_COUNT ? &FIT_RECORD_COLUMNS[column_id] : nullptr;
 }
 
-// ===== FIT ACTIVITIES TABLE FUNCTION =====
-static unique_ptr<FunctionData> FitActivitiesBind(ClientContext &context, TableFunctionBindInput &input,
-                                                  vector<LogicalType> &return_types, vector<string> &names) {
-	auto file_path = input.inputs[0].GetValue<string>();
-
-	// Define schema for activities metadata table
-	vector<pair<string, LogicalType>> columns = {{"activity_id", LogicalType::UBIGINT},
-	                                             {"file_id", LogicalType::VARCHAR},
-	                                             {"timestamp", LogicalType::TIMESTAMP_TZ},
-	                                             {"local_timestamp", LogicalType::TIMESTAMP_TZ},
-	                                             {"start_time", LogicalType::TIMESTAMP_TZ},
-	                                             {"total_timer_time", LogicalType::DOUBLE},
-	                                             {"total_elapsed_time", LogicalType::DOUBLE},
-	                                             {"total_distance", LogicalType::DOUBLE},
-	                                             {"sport", LogicalType::VARCHAR},
-	                                             {"sub_sport", LogicalType::VARCHAR},
-	                                             {"manufacturer", LogicalType::VARCHAR},
-	                                             {"product", LogicalType::VARCHAR},
-	                                             {"device_serial_number", LogicalType::UBIGINT},
-	                                             {"software_version", LogicalType::VARCHAR},
-	                                             {"total_calories", LogicalType::UINTEGER},
-	                                             {"total_ascent", LogicalType::DOUBLE},
-	                                             {"total_descent", LogicalType::DOUBLE},
-	                                             {"avg_heart_rate", LogicalType::UTINYINT},
-	                                             {"max_heart_rate", LogicalType::UTINYINT},
-	                                             {"avg_speed", LogicalType::DOUBLE},
-	                                             {"max_speed", LogicalType::DOUBLE},
-	                                             {"avg_power", LogicalType::USMALLINT},
-	                                             {"max_power", LogicalType::USMALLINT},
-	                                             {"avg_cadence", LogicalType::UTINYINT},
-	                                             {"max_cadence", LogicalType::UTINYINT},
-	                                             {"start_position_lat", LogicalType::DOUBLE},
-	                                             {"start_position_long", LogicalType::DOUBLE},
-	                                             {"end_position_lat", LogicalType::DOUBLE},
-	                                             {"end_position_long", LogicalType::DOUBLE},
-	                                             {"file_source", LogicalType::VARCHAR}};
-
-	for (const auto &col : columns) {
-		names.push_back(col.first);
-		return_types.push_back(col.second);
-	}
-
-	return make_uniq<FitTableFunctionData>(file_path, "activities", &context);
+// Narrows a timestamp range with the comparison of the timestamp column to a constant bound,
+// e.g. timestamp >= TIMESTAMPTZ '2025-09-01'. Bounds that are not constant are ignored.
+static void NarrowFitTimestampRange(ClientContext &context, FitTimestampRange &range, ExpressionType comparison,
+                                    const Expression &bound) {
+	if (!bound.IsFoldable() || bound.return_type.id() != LogicalTypeId::TIMESTAMP_TZ) {
+		return;
+	}
+	Value value;
+	if (!ExpressionExecutor::TryEvaluateScalar(context, bound, value) || value.IsNull()) {
+		return;
+	}
+	// Record timestamps are whole FIT seconds
+	auto micros = value.GetValueUnsafe<int64_t>();
+	auto seconds = micros / Interval::MICROS_PER_SEC - (micros % Interval::MICROS_PER_SEC < 0 ? 1 : 0);
+	bool exact = micros % Interval::MICROS_PER_SEC == 0;
+	seconds -= 631065600;
+
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		range.min = MaxValue(range.min, exact ? seconds : seconds + 1);
+		range.max = MinValue(range.max, seconds);
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		range.min = MaxValue(range.min, seconds + 1);
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		range.min = MaxValue(range.min, exact ? seconds : seconds + 1);
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		range.max = MinValue(range.max, exact ? seconds - 1 : seconds);
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		range.max = MinValue(range.max, seconds);
+		break;
+	default:
+		break;
+	}
 }
 
-static void FitActivitiesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &data = (FitTableFunctionData &)*data_p.bind_data;
+// Smallest raw value in [raw_min, raw_max] whose output value passes a test, raw_max + 1 if none
+// does. The test must keep passing once it passed, output values grow with raw values.
+template <class TEST>
+static double FindFitRawValue(double raw_min, double raw_max, TEST passes) {
+	double low = raw_min;
+	double high = raw_max + 1;
+	while (low < high) {
+		double middle = std::floor((low + high) / 2);
+		if (passes(middle)) {
+			high = middle;
+		} else {
+			low = middle + 1;
+		}
+	}
+	return low;
+}
 
-	idx_t remaining_rows = data.fit_activities.size() - data.current_row;
-	idx_t rows_to_output = MinValue<idx_t>(remaining_rows, STANDARD_VECTOR_SIZE);
+// Narrows the raw range of a record field with the comparison of its column to a constant bound.
+// Thresholds are searched on the raw integers through the scale and offset of the field and the
+// conversion of its column, so the raw range keeps exactly the records the comparison keeps.
+static void NarrowFitRecordFilter(ClientContext &context, vector<FitRecordFilter> &filters,
+                                  const FitRecordColumn &column, ExpressionType comparison, const Expression &bound) {
+	double raw_min, raw_max;
+	auto field = fit::Profile::GetField(FIT_MESG_NUM_RECORD, column.field_num);
+	if (!field || !FitFieldExtractor::GetRawRange(FIT_MESG_NUM_RECORD, column.field_num, raw_min, raw_max) ||
+	    !bound.IsFoldable() || !bound.return_type.IsNumeric()) {
+		return;
+	}
+	Value value;
+	if (!ExpressionExecutor::TryEvaluateScalar(context, bound, value) || value.IsNull()) {
+		return;
+	}
+	auto constant = value.DefaultCastAs(LogicalType::DOUBLE).GetValue<double>();
+	if (!std::isfinite(constant)) {
+		return;
+	}
 
-	if (rows_to_output == 0) {
-		output.SetCardinality(0);
+	auto first_at_least = FindFitRawValue(raw_min, raw_max, [&](double raw) {
+		return GetFitRecordOutputValue(column, *field, raw) >= constant;
+	});
+	auto first_above = FindFitRawValue(raw_min, raw_max, [&](double raw) {
+		return GetFitRecordOutputValue(column, *field, raw) > constant;
+	});
+	switch (comparison) {
+	case ExpressionType::COMPARE_EQUAL:
+		raw_min = first_at_least;
+		raw_max = first_above - 1;
+		break;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		raw_min = first_above;
+		break;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		raw_min = first_at_least;
+		break;
+	case ExpressionType::COMPARE_LESSTHAN:
+		raw_max = first_at_least - 1;
+		break;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		raw_max = first_above - 1;
+		break;
+	default:
 		return;
 	}
 
-	for (idx_t row = 0; row < rows_to_output; row++) {
-		const auto &activity = data.fit_activities[data.current_row + row];
-		idx_t col = 0;
-
-		output.SetValue(col++, row, Value::UBIGINT(activity.activity_id));
-		output.SetValue(col++, row, Value(activity.file_id));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(activity.timestamp));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(activity.local_timestamp));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(activity.start_time));
-		output.SetValue(col++, row, Value::DOUBLE(activity.total_timer_time));
-		output.SetValue(col++, row, Value::DOUBLE(activity.total_elapsed_time));
-		output.SetValue(col++, row, Value::DOUBLE(activity.total_distance));
-		output.SetValue(col++, row, Value(activity.sport));
-		output.SetValue(col++, row, Value(activity.sub_sport));
-		output.SetValue(col++, row, Value(activity.manufacturer));
-		output.SetValue(col++, row, Value(activity.product));
-		output.SetValue(col++, row, Value::UBIGINT(activity.device_serial_number));
-		output.SetValue(col++, row, Value(activity.software_version));
-		output.SetValue(col++, row, Value::UINTEGER(activity.total_calories));
-		output.SetValue(col++, row, Value::DOUBLE(activity.total_ascent));
-		output.SetValue(col++, row, Value::DOUBLE(activity.total_descent));
-		output.SetValue(col++, row, activity.avg_heart_rate > 0 ? Value::UTINYINT(activity.avg_heart_rate) : Value());
-		output.SetValue(col++, row, activity.max_heart_rate > 0 ? Value::UTINYINT(activity.max_heart_rate) : Value());
-		output.SetValue(col++, row, Value::DOUBLE(activity.avg_speed));
-		output.SetValue(col++, row, Value::DOUBLE(activity.max_speed));
-		output.SetValue(col++, row, activity.avg_power > 0 ? Value::USMALLINT(activity.avg_power) : Value());
-		output.SetValue(col++, row, activity.max_power > 0 ? Value::USMALLINT(activity.max_power) : Value());
-		output.SetValue(col++, row, activity.avg_cadence > 0 ? Value::UTINYINT(activity.avg_cadence) : Value());
-		output.SetValue(col++, row, activity.max_cadence > 0 ? Value::UTINYINT(activity.max_cadence) : Value());
-		output.SetValue(col++, row,
-		                activity.start_position_lat != 0.0 ? Value::DOUBLE(activity.start_position_lat) : Value());
-		output.SetValue(col++, row,
-		                activity.start_position_long != 0.0 ? Value::DOUBLE(activity.start_position_long) : Value());
-		output.SetValue(col++, row,
-		                activity.end_position_lat != 0.0 ? Value::DOUBLE(activity.end_position_lat) : Value());
-		output.SetValue(col++, row,
-		                activity.end_position_long != 0.0 ? Value::DOUBLE(activity.end_position_long) : Value());
-		output.SetValue(col++, row, !activity.file_source.empty() ? Value(activity.file_source) : Value());
+	for (auto &filter : filters) {
+		if (filter.column == &column) {
+			filter.raw_min = MaxValue(filter.raw_min, raw_min);
+			filter.raw_max = MinValue(filter.raw_max, raw_max);
+			return;
+		}
 	}
+	filters.push_back({&column, raw_min, raw_max});
+}
 
-	output.SetCardinality(rows_to_output);
-	data.current_row += rows_to_output;
+// Narrows the timestamp range or the raw range of a record field with a comparison of its column
+static void NarrowFitRecordColumn(ClientContext &context, FitTableFunctionData &bind_data,
+                                  const FitRecordColumn &column, ExpressionType comparison, const Expression &bound) {
+	if (&column == &FIT_RECORD_COLUMNS[0]) {
+		NarrowFitTimestampRange(context, bind_data.timestamp_range, comparison, bound);
+	} else if (column.source == FitRecordSource::FIELD) {
+		NarrowFitRecordFilter(context, bind_data.record_filters, column, comparison, bound);
+	}
 }
 
-// (Additional table functions would go here - continuing in next message due to length...)
+// Records a filter keeps, from comparisons and BETWEEN of record columns with constants
+static void PushdownFitRecordFilter(ClientContext &context, const LogicalGet &get, FitTableFunctionData &bind_data,
+                                    const Expression &filter) {
+	if (filter.GetExpressionClass() == ExpressionClass::BOUND_COMPARISON) {
+		auto &comparison = filter.Cast<BoundComparisonExpression>();
+		if (auto column = GetFitRecordColumn(get, *comparison.left)) {
+			NarrowFitRecordColumn(context, bind_data, *column, comparison.GetExpressionType(), *comparison.right);
+		} else if (auto column = GetFitRecordColumn(get, *comparison.right)) {
+			NarrowFitRecordColumn(context, bind_data, *column,
+			                      FlipComparisonExpression(comparison.GetExpressionType()), *comparison.left);
+		}
+	} else if (filter.GetExpressionClass() == ExpressionClass::BOUND_BETWEEN) {
+		auto &between = filter.Cast<BoundBetweenExpression>();
+		if (auto column = GetFitRecordColumn(get, *between.input)) {
+			NarrowFitRecordColumn(context, bind_data, *column,
+			                      between.lower_inclusive ? ExpressionType::COMPARE_GREATERTHANOREQUALTO
+			                                              : ExpressionType::COMPARE_GREATERTHAN,
+			                      *between.lower);
+			NarrowFitRecordColumn(context, bind_data, *column,
+			                      between.upper_inclusive ? ExpressionType::COMPARE_LESSTHANOREQUALTO
+			                                              : ExpressionType::COMPARE_LESSTHAN,
+			                      *between.upper);
+		}
+	}
+}
 
-// ===== FIT SESSIONS TABLE FUNCTION =====
-static unique_ptr<FunctionData> FitSessionsBind(ClientContext &context, TableFunctionBindInput &input,
-                                                vector<LogicalType> &return_types, vector<string> &names) {
-	auto file_path = input.inputs[0].GetValue<string>();
-
-	vector<pair<string, LogicalType>> columns = {
-	    {"session_id", LogicalType::UINTEGER},       {"activity_id", LogicalType::UBIGINT},
-	    {"timestamp", LogicalType::TIMESTAMP_TZ},    {"start_time", LogicalType::TIMESTAMP_TZ},
-	    {"total_elapsed_time", LogicalType::DOUBLE}, {"total_timer_time", LogicalType::DOUBLE},
-	    {"total_distance", LogicalType::DOUBLE},     {"sport", LogicalType::VARCHAR},
-	    {"sub_sport", LogicalType::VARCHAR},         {"total_calories", LogicalType::UINTEGER},
-	    {"avg_speed", LogicalType::DOUBLE},          {"max_speed", LogicalType::DOUBLE},
-	    {"avg_heart_rate", LogicalType::UTINYINT},   {"max_heart_rate", LogicalType::UTINYINT},
-	    {"min_heart_rate", LogicalType::UTINYINT},   {"avg_cadence", LogicalType::UTINYINT},
-	    {"max_cadence", LogicalType::UTINYINT},      {"avg_power", LogicalType::USMALLINT},
-	    {"max_power", LogicalType::USMALLINT},       {"normalized_power", LogicalType::USMALLINT},
-	    {"intensity_factor", LogicalType::DOUBLE},   {"training_stress_score", LogicalType::DOUBLE},
-	    {"total_work", LogicalType::UINTEGER},       {"total_ascent", LogicalType::DOUBLE},
-	    {"total_descent", LogicalType::DOUBLE},      {"first_lap_index", LogicalType::UTINYINT},
-	    {"num_laps", LogicalType::UTINYINT},         {"event", LogicalType::VARCHAR},
-	    {"event_type", LogicalType::VARCHAR},        {"trigger", LogicalType::VARCHAR},
-	    {"file_source", LogicalType::VARCHAR}};
-
-	for (const auto &col : columns) {
-		names.push_back(col.first);
-		return_types.push_back(col.second);
-	}
-
-	return make_uniq<FitTableFunctionData>(file_path, "sessions", &context);
+// Uses the filters of a scan to skip work before any row is emitted: files of other hive partitions
+// are pruned, records scans skip the files and records outside of the timestamp range and drop the
+// records failing numeric comparisons in the decoder. The filters are kept and still applied to the
+// emitted rows.
+static void FitPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
+                                     vector<unique_ptr<Expression>> &filters) {
+	auto &bind_data = bind_data_p->Cast<FitTableFunctionData>();
+	for (auto &filter : filters) {
+		if (!bind_data.partition_names.empty()) {
+			PruneFitPartitions(context, get, bind_data, filter);
+		}
+		if (bind_data.table_type == "records") {
+			PushdownFitRecordFilter(context, get, bind_data, *filter);
+		}
+	}
 }
 
-static void FitSessionsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &data = (FitTableFunctionData &)*data_p.bind_data;
+// Rows are emitted in file order when insertion order must be preserved
+static OperatorPartitionData FitGetPartitionData(ClientContext &context, TableFunctionGetPartitionInput &input) {
+	auto &state = input.local_state->Cast<FitScanLocalState>();
+	return OperatorPartitionData(state.file_index);
+}
 
-	idx_t remaining_rows = data.fit_sessions.size() - data.current_row;
-	idx_t rows_to_output = MinValue<idx_t>(remaining_rows, STANDARD_VECTOR_SIZE);
+// Decodes files until one has rows of the table left to emit. A chunk holds rows of a single
+// file, so that its index orders the chunks.
+// Returns the number of rows of the next chunk, 0 once all files are scanned
+template <class TABLE>
+static idx_t FitNextRows(TableFunctionInput &data_p, TABLE FitDataCollector::*table) {
+	auto &bind_data = data_p.bind_data->Cast<FitTableFunctionData>();
+	auto &global_state = data_p.global_state->Cast<FitScanGlobalState>();
+	auto &state = data_p.local_state->Cast<FitScanLocalState>();
+
+	while (!state.collector || state.current_row >= ((*state.collector).*table).size()) {
+		if (state.decoder) {
+			state.DecodeRecords(bind_data, global_state);
+		} else if (!state.DecodeNextFile(bind_data, global_state)) {
+			return 0;
+		}
+	}
+	return MinValue<idx_t>(((*state.collector).*table).size() - state.current_row, STANDARD_VECTOR_SIZE);
+}
 
-	if (rows_to_output == 0) {
-		output.SetCardinality(0);
-		return;
+// Writes count rows of a table from row offset on into the output, one vector per projected column
+template <class ROW, idx_t N>
+static void WriteFitRows(const FitColumn<ROW> (&columns)[N], const std::vector<ROW> &rows,
+                         const vector<column_t> &column_ids, idx_t offset, idx_t count, DataChunk &output) {
+	for (idx_t col = 0; col < column_ids.size(); col++) {
+		auto column_id = column_ids[col];
+		if (column_id >= N) {
+			// Row id of a scan without columns (e.g. COUNT(*)), nothing to write
+			continue;
+		}
+		columns[column_id].write(rows.data() + offset, count, output.data[col], 0);
 	}
+}
+
+// Hive partition columns hold the same value for every row of a file
+static void WriteFitPartitions(const FitTableFunctionData &bind_data, idx_t file_index,
+                               const vector<column_t> &column_ids, DataChunk &output) {
+	auto first_partition = bind_data.column_names.size();
+	for (idx_t col = 0; col < column_ids.size(); col++) {
+		auto column_id = column_ids[col];
+		if (column_id >= first_partition && column_id < first_partition + bind_data.partition_names.size()) {
+			output.data[col].Reference(bind_data.partition_values[file_index][column_id - first_partition]);
+		}
+	}
+}
 
-	for (idx_t row = 0; row < rows_to_output; row++) {
-		const auto &session = data.fit_sessions[data.current_row + row];
-		idx_t col = 0;
-
-		output.SetValue(col++, row, Value::UINTEGER(session.session_id));
-		output.SetValue(col++, row, Value::UBIGINT(session.activity_id));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(session.timestamp));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(session.start_time));
-		output.SetValue(col++, row, Value::DOUBLE(session.total_elapsed_time));
-		output.SetValue(col++, row, Value::DOUBLE(session.total_timer_time));
-		output.SetValue(col++, row, Value::DOUBLE(session.total_distance));
-		output.SetValue(col++, row, Value(session.sport));
-		output.SetValue(col++, row, Value(session.sub_sport));
-		output.SetValue(col++, row, Value::UINTEGER(session.total_calories));
-		output.SetValue(col++, row, Value::DOUBLE(session.avg_speed));
-		output.SetValue(col++, row, Value::DOUBLE(session.max_speed));
-		output.SetValue(col++, row, session.avg_heart_rate > 0 ? Value::UTINYINT(session.avg_heart_rate) : Value());
-		output.SetValue(col++, row, session.max_heart_rate > 0 ? Value::UTINYINT(session.max_heart_rate) : Value());
-		output.SetValue(col++, row, session.min_heart_rate > 0 ? Value::UTINYINT(session.min_heart_rate) : Value());
-		output.SetValue(col++, row, session.avg_cadence > 0 ? Value::UTINYINT(session.avg_cadence) : Value());
-		output.SetValue(col++, row, session.max_cadence > 0 ? Value::UTINYINT(session.max_cadence) : Value());
-		output.SetValue(col++, row, session.avg_power > 0 ? Value::USMALLINT(session.avg_power) : Value());
-		output.SetValue(col++, row, session.max_power > 0 ? Value::USMALLINT(session.max_power) : Value());
-		output.SetValue(col++, row,
-		                session.normalized_power > 0 ? Value::USMALLINT(session.normalized_power) : Value());
-		output.SetValue(col++, row, Value::DOUBLE(session.intensity_factor));
-		output.SetValue(col++, row, Value::DOUBLE(session.training_stress_score));
-		output.SetValue(col++, row, Value::UINTEGER(session.total_work));
-		output.SetValue(col++, row, Value::DOUBLE(session.total_ascent));
-		output.SetValue(col++, row, Value::DOUBLE(session.total_descent));
-		output.SetValue(col++, row, Value::UTINYINT(session.first_lap_index));
-		output.SetValue(col++, row, Value::UTINYINT(session.num_laps));
-		output.SetValue(col++, row, Value(session.event));
-		output.SetValue(col++, row, Value(session.event_type));
-		output.SetValue(col++, row, Value(session.trigger));
+// Fills the output chunk with the next rows of a table, only the projected columns are written
+template <class ROW, idx_t N>
+static void FitScanRows(const FitColumn<ROW> (&columns)[N], std::vector<ROW> FitDataCollector::*table,
+                        TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<FitTableFunctionData>();
+	auto &global_state = data_p.global_state->Cast<FitScanGlobalState>();
+	auto &state = data_p.local_state->Cast<FitScanLocalState>();
+
+	idx_t rows_to_output = FitNextRows(data_p, table);
+	if (rows_to_output > 0) {
+		WriteFitRows(columns, (*state.collector).*table, global_state.column_ids, state.current_row, rows_to_output,
+		             output);
+		AddFitIdBase(state.id_base, bind_data.column_names, global_state.column_ids, rows_to_output, output);
+		WriteFitPartitions(bind_data, state.file_index, global_state.column_ids, output);
 	}
 
 	output.SetCardinality(rows_to_output);
-	data.current_row += rows_to_output;
+	state.current_row += rows_to_output;
 }
 
-// ===== FIT LAPS TABLE FUNCTION =====
-static unique_ptr<FunctionData> FitLapsBind(ClientContext &context, TableFunctionBindInput &input,
-                                            vector<LogicalType> &return_types, vector<string> &names) {
-	auto file_path = input.inputs[0].GetValue<string>();
-
-	// Define lap columns based on FitLap structure
-	names = {"lap_id",
-	         "session_id",
-	         "activity_id",
-	         "timestamp",
-	         "start_time",
-	         "total_elapsed_time",
-	         "total_timer_time",
-	         "total_distance",
-	         "total_calories",
-	         "avg_speed",
-	         "max_speed",
-	         "avg_heart_rate",
-	         "max_heart_rate",
-	         "min_heart_rate",
-	         "avg_cadence",
-	         "max_cadence",
-	         "avg_power",
-	         "max_power",
-	         "total_ascent",
-	         "total_descent",
-	         "lap_trigger",
-	         "event",
-	         "event_type",
-	         "start_position_lat",
-	         "start_position_long",
-	         "end_position_lat",
-	         "end_position_long",
-	         "file_source"};
-
-	return_types = {LogicalType::UINTEGER,     LogicalType::UINTEGER,  LogicalType::UBIGINT,  LogicalType::TIMESTAMP_TZ,
-	                LogicalType::TIMESTAMP_TZ, LogicalType::DOUBLE,    LogicalType::DOUBLE,   LogicalType::DOUBLE,
-	                LogicalType::UINTEGER,     LogicalType::DOUBLE,    LogicalType::DOUBLE,   LogicalType::UTINYINT,
-	                LogicalType::UTINYINT,     LogicalType::UTINYINT,  LogicalType::UTINYINT, LogicalType::UTINYINT,
-	                LogicalType::USMALLINT,    LogicalType::USMALLINT, LogicalType::DOUBLE,   LogicalType::DOUBLE,
-	                LogicalType::VARCHAR,      LogicalType::VARCHAR,   LogicalType::VARCHAR,  LogicalType::DOUBLE,
-	                LogicalType::DOUBLE,       LogicalType::DOUBLE,    LogicalType::DOUBLE,   LogicalType::VARCHAR};
-
-	return make_uniq<FitTableFunctionData>(file_path, "laps", &context);
-}
+// ===== FIT RECORDS TABLE FUNCTION =====
+static unique_ptr<FunctionData> FitTableBind(ClientContext &context, TableFunctionBindInput &input,
+                                             vector<LogicalType> &return_types, vector<string> &names) {
+	// Get the input parameter (file path, glob pattern or list of them)
+	auto patterns = GetFitFilePatterns(input.inputs[0]);
 
-static void FitLapsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &data = (FitTableFunctionData &)*data_p.bind_data;
+	AddFitColumns(FIT_RECORD_COLUMNS, return_types, names);
+
+	auto result = make_uniq<FitTableFunctionData>(patterns, "records", names, context, ParseScanOptions(input));
+	result->BindPartitionColumns(return_types, names);
+	return std::move(result);
+}
 
-	idx_t remaining_rows = data.fit_laps.size() - data.current_row;
-	idx_t rows_to_output = MinValue<idx_t>(remaining_rows, STANDARD_VECTOR_SIZE);
+// Record fields are copied from the column buffer of the file, the other columns hold the same
+// value for every record of the file
+static void WriteFitRecords(const FitDataCollector &collector, const vector<column_t> &column_ids, idx_t offset,
+                            idx_t count, DataChunk &output) {
+	for (idx_t col = 0; col < column_ids.size(); col++) {
+		auto column_id = column_ids[col];
+		if (column_id >= FIT_RECORD_COLUMN_COUNT) {
+			// Row id of a scan without columns (e.g. COUNT(*)), nothing to write
+			continue;
+		}
+		auto &column = FIT_RECORD_COLUMNS[column_id];
+		auto &result = output.data[col];
+		if (column.source == FitRecordSource::FIELD) {
+			collector.records.Scan(collector.RecordSlot(column), offset, count, result);
+			continue;
+		}
 
-	if (rows_to_output == 0) {
-		output.SetCardinality(0);
-		return;
+		// Same value for the whole file, NULL without a session sport or for columns not decoded
+		string value;
+		if (column.source == FitRecordSource::ACTIVITY_TYPE) {
+			value = collector.record_activity_type;
+		} else if (column.source == FitRecordSource::FILE_SOURCE) {
+			value = collector.current_file_source;
+		}
+		result.Reference(value.empty() ? Value(result.GetType()) : Value(value));
 	}
+}
 
-	// Fill the output chunk with lap data
-	for (idx_t row = 0; row < rows_to_output; row++) {
-		const auto &fit_lap = data.fit_laps[data.current_row + row];
-		idx_t col = 0;
-
-		output.SetValue(col++, row, Value::UINTEGER(fit_lap.lap_id));
-		output.SetValue(col++, row, Value::UINTEGER(fit_lap.session_id));
-		output.SetValue(col++, row, Value::UBIGINT(fit_lap.activity_id));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(fit_lap.timestamp));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(fit_lap.start_time));
-		output.SetValue(col++, row,
-		                fit_lap.total_elapsed_time > 0.0 ? Value::DOUBLE(fit_lap.total_elapsed_time) : Value());
-		output.SetValue(col++, row, fit_lap.total_timer_time > 0.0 ? Value::DOUBLE(fit_lap.total_timer_time) : Value());
-		output.SetValue(col++, row, fit_lap.total_distance > 0.0 ? Value::DOUBLE(fit_lap.total_distance) : Value());
-		output.SetValue(col++, row, fit_lap.total_calories > 0 ? Value::UINTEGER(fit_lap.total_calories) : Value());
-		output.SetValue(col++, row, fit_lap.avg_speed > 0.0 ? Value::DOUBLE(fit_lap.avg_speed) : Value());
-		output.SetValue(col++, row, fit_lap.max_speed > 0.0 ? Value::DOUBLE(fit_lap.max_speed) : Value());
-		output.SetValue(col++, row, fit_lap.avg_heart_rate > 0 ? Value::UTINYINT(fit_lap.avg_heart_rate) : Value());
-		output.SetValue(col++, row, fit_lap.max_heart_rate > 0 ? Value::UTINYINT(fit_lap.max_heart_rate) : Value());
-		output.SetValue(col++, row, fit_lap.min_heart_rate > 0 ? Value::UTINYINT(fit_lap.min_heart_rate) : Value());
-		output.SetValue(col++, row, fit_lap.avg_cadence > 0 ? Value::UTINYINT(fit_lap.avg_cadence) : Value());
-		output.SetValue(col++, row, fit_lap.max_cadence > 0 ? Value::UTINYINT(fit_lap.max_cadence) : Value());
-		output.SetValue(col++, row, fit_lap.avg_power > 0 ? Value::USMALLINT(fit_lap.avg_power) : Value());
-		output.SetValue(col++, row, fit_lap.max_power > 0 ? Value::USMALLINT(fit_lap.max_power) : Value());
-		output.SetValue(col++, row, fit_lap.total_ascent > 0.0 ? Value::DOUBLE(fit_lap.total_ascent) : Value());
-		output.SetValue(col++, row, fit_lap.total_descent > 0.0 ? Value::DOUBLE(fit_lap.total_descent) : Value());
-		output.SetValue(col++, row, Value(fit_lap.lap_trigger));
-		output.SetValue(col++, row, Value(fit_lap.event));
-		output.SetValue(col++, row, Value(fit_lap.event_type));
-		output.SetValue(col++, row,
-		                fit_lap.start_position_lat != 0.0 ? Value::DOUBLE(fit_lap.start_position_lat) : Value());
-		output.SetValue(col++, row,
-		                fit_lap.start_position_long != 0.0 ? Value::DOUBLE(fit_lap.start_position_long) : Value());
-		output.SetValue(col++, row,
-		                fit_lap.end_position_lat != 0.0 ? Value::DOUBLE(fit_lap.end_position_lat) : Value());
-		output.SetValue(col++, row,
-		                fit_lap.end_position_long != 0.0 ? Value::DOUBLE(fit_lap.end_position_long) : Value());
+static void FitTableFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<FitTableFunctionData>();
+	auto &global_state = data_p.global_state->Cast<FitScanGlobalState>();
+	auto &state = data_p.local_state->Cast<FitScanLocalState>();
+
+	idx_t rows_to_output = FitNextRows(data_p, &FitDataCollector::records);
+	if (rows_to_output > 0) {
+		WriteFitRecords(*state.collector, global_state.column_ids, state.current_row, rows_to_output, output);
+		WriteFitPartitions(bind_data, state.file_index, global_state.column_ids, output);
 	}
 
 	output.SetCardinality(rows_to_output);
-	data.current_row += rows_to_output;
+	state.current_row += rows_to_output;
+}
+
+// ===== FIT ACTIVITIES TABLE FUNCTION =====
+static const FitColumn<FitActivity> FIT_ACTIVITY_COLUMNS[] = {
+    FIT_COLUMN(FitActivity, activity_id, UBIGINT, NEVER),
+    FIT_COLUMN(FitActivity, file_id, VARCHAR, NEVER),
+    FIT_COLUMN(FitActivity, timestamp, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitActivity, local_timestamp, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitActivity, start_time, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitActivity, total_timer_time, DOUBLE, NEVER),
+    FIT_COLUMN(FitActivity, total_elapsed_time, DOUBLE, NEVER),
+    FIT_COLUMN(FitActivity, total_distance, DOUBLE, NEVER),
+    FIT_COLUMN(FitActivity, sport, VARCHAR, NEVER),
+    FIT_COLUMN(FitActivity, sub_sport, VARCHAR, NEVER),
+    FIT_COLUMN(FitActivity, manufacturer, VARCHAR, NEVER),
+    FIT_COLUMN(FitActivity, product, VARCHAR, NEVER),
+    FIT_COLUMN(FitActivity, device_serial_number, UBIGINT, NEVER),
+    FIT_COLUMN(FitActivity, software_version, VARCHAR, NEVER),
+    FIT_COLUMN(FitActivity, total_calories, UINTEGER, NEVER),
+    FIT_COLUMN(FitActivity, total_ascent, DOUBLE, NEVER),
+    FIT_COLUMN(FitActivity, total_descent, DOUBLE, NEVER),
+    FIT_COLUMN(FitActivity, avg_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitActivity, max_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitActivity, avg_speed, DOUBLE, NEVER),
+    FIT_COLUMN(FitActivity, max_speed, DOUBLE, NEVER),
+    FIT_COLUMN(FitActivity, avg_power, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitActivity, max_power, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitActivity, avg_cadence, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitActivity, max_cadence, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitActivity, start_position_lat, DOUBLE, IF_ZERO),
+    FIT_COLUMN(FitActivity, start_position_long, DOUBLE, IF_ZERO),
+    FIT_COLUMN(FitActivity, end_position_lat, DOUBLE, IF_ZERO),
+    FIT_COLUMN(FitActivity, end_position_long, DOUBLE, IF_ZERO),
+    FIT_COLUMN(FitActivity, file_source, VARCHAR, IF_ZERO),
+};
+
+static unique_ptr<FunctionData> FitActivitiesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+	auto patterns = GetFitFilePatterns(input.inputs[0]);
+
+	AddFitColumns(FIT_ACTIVITY_COLUMNS, return_types, names);
+
+	auto result = make_uniq<FitTableFunctionData>(patterns, "activities", names, context, ParseScanOptions(input));
+	result->BindPartitionColumns(return_types, names);
+	return std::move(result);
+}
+
+static void FitActivitiesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	FitScanRows(FIT_ACTIVITY_COLUMNS, &FitDataCollector::activities, data_p, output);
+}
+
+// ===== FIT SESSIONS TABLE FUNCTION =====
+static const FitColumn<FitSession> FIT_SESSION_COLUMNS[] = {
+    FIT_COLUMN(FitSession, session_id, UINTEGER, NEVER),
+    FIT_COLUMN(FitSession, activity_id, UBIGINT, NEVER),
+    FIT_COLUMN(FitSession, timestamp, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitSession, start_time, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitSession, total_elapsed_time, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, total_timer_time, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, total_distance, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, sport, VARCHAR, NEVER),
+    FIT_COLUMN(FitSession, sub_sport, VARCHAR, NEVER),
+    FIT_COLUMN(FitSession, total_calories, UINTEGER, NEVER),
+    FIT_COLUMN(FitSession, avg_speed, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, max_speed, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, avg_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitSession, max_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitSession, min_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitSession, avg_cadence, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitSession, max_cadence, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitSession, avg_power, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitSession, max_power, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitSession, normalized_power, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitSession, intensity_factor, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, training_stress_score, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, total_work, UINTEGER, NEVER),
+    FIT_COLUMN(FitSession, total_ascent, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, total_descent, DOUBLE, NEVER),
+    FIT_COLUMN(FitSession, first_lap_index, UTINYINT, NEVER),
+    FIT_COLUMN(FitSession, num_laps, UTINYINT, NEVER),
+    FIT_COLUMN(FitSession, event, VARCHAR, NEVER),
+    FIT_COLUMN(FitSession, event_type, VARCHAR, NEVER),
+    FIT_COLUMN(FitSession, trigger, VARCHAR, NEVER),
+    FIT_COLUMN(FitSession, file_source, VARCHAR, IF_ZERO),
+};
+
+static unique_ptr<FunctionData> FitSessionsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                vector<LogicalType> &return_types, vector<string> &names) {
+	auto patterns = GetFitFilePatterns(input.inputs[0]);
+
+	AddFitColumns(FIT_SESSION_COLUMNS, return_types, names);
+
+	auto result = make_uniq<FitTableFunctionData>(patterns, "sessions", names, context, ParseScanOptions(input));
+	result->BindPartitionColumns(return_types, names);
+	return std::move(result);
+}
+
+static void FitSessionsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	FitScanRows(FIT_SESSION_COLUMNS, &FitDataCollector::sessions, data_p, output);
+}
+
+// ===== FIT LAPS TABLE FUNCTION =====
+static const FitColumn<FitLap> FIT_LAP_COLUMNS[] = {
+    FIT_COLUMN(FitLap, lap_id, UINTEGER, NEVER),
+    FIT_COLUMN(FitLap, session_id, UINTEGER, NEVER),
+    FIT_COLUMN(FitLap, activity_id, UBIGINT, NEVER),
+    FIT_COLUMN(FitLap, timestamp, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitLap, start_time, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitLap, total_elapsed_time, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitLap, total_timer_time, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitLap, total_distance, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitLap, total_calories, UINTEGER, IF_ZERO),
+    FIT_COLUMN(FitLap, avg_speed, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitLap, max_speed, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitLap, avg_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitLap, max_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitLap, min_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitLap, avg_cadence, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitLap, max_cadence, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitLap, avg_power, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitLap, max_power, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitLap, total_ascent, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitLap, total_descent, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitLap, lap_trigger, VARCHAR, NEVER),
+    FIT_COLUMN(FitLap, event, VARCHAR, NEVER),
+    FIT_COLUMN(FitLap, event_type, VARCHAR, NEVER),
+    FIT_COLUMN(FitLap, start_position_lat, DOUBLE, IF_ZERO),
+    FIT_COLUMN(FitLap, start_position_long, DOUBLE, IF_ZERO),
+    FIT_COLUMN(FitLap, end_position_lat, DOUBLE, IF_ZERO),
+    FIT_COLUMN(FitLap, end_position_long, DOUBLE, IF_ZERO),
+    FIT_COLUMN(FitLap, file_source, VARCHAR, IF_ZERO),
+};
+
+static unique_ptr<FunctionData> FitLapsBind(ClientContext &context, TableFunctionBindInput &input,
+                                            vector<LogicalType> &return_types, vector<string> &names) {
+	auto patterns = GetFitFilePatterns(input.inputs[0]);
+
+	AddFitColumns(FIT_LAP_COLUMNS, return_types, names);
+
+	auto result = make_uniq<FitTableFunctionData>(patterns, "laps", names, context, ParseScanOptions(input));
+	result->BindPartitionColumns(return_types, names);
+	return std::move(result);
+}
+
+static void FitLapsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	FitScanRows(FIT_LAP_COLUMNS, &FitDataCollector::laps, data_p, output);
 }
 
 // ===== FIT DEVICES TABLE FUNCTION =====
+static const FitColumn<FitDevice> FIT_DEVICE_COLUMNS[] = {
+    FIT_COLUMN(FitDevice, device_id, UINTEGER, NEVER),
+    FIT_COLUMN(FitDevice, activity_id, UBIGINT, NEVER),
+    FIT_COLUMN(FitDevice, device_index, UTINYINT, NEVER),
+    FIT_COLUMN(FitDevice, device_type, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, manufacturer, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, product, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, serial_number, UBIGINT, IF_ZERO),
+    FIT_COLUMN(FitDevice, software_version, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, hardware_version, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, cum_operating_time, UINTEGER, IF_ZERO),
+    FIT_COLUMN(FitDevice, battery_status, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, sensor_position, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, descriptor, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, ant_transmission_type, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitDevice, ant_device_number, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitDevice, ant_network, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, source_type, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, product_name, VARCHAR, NEVER),
+    FIT_COLUMN(FitDevice, battery_voltage, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitDevice, file_source, VARCHAR, IF_ZERO),
+};
+
 static unique_ptr<FunctionData> FitDevicesBind(ClientContext &context, TableFunctionBindInput &input,
                                                vector<LogicalType> &return_types, vector<string> &names) {
-	auto file_path = input.inputs[0].GetValue<string>();
+	auto patterns = GetFitFilePatterns(input.inputs[0]);
 
-	// Define device columns based on FitDevice structure
-	names = {"device_id",      "activity_id",     "device_index",     "device_type",           "manufacturer",
-	         "product",        "serial_number",   "software_version", "hardware_version",      "cum_operating_time",
-	         "battery_status", "sensor_position", "descriptor",       "ant_transmission_type", "ant_device_number",
-	         "ant_network",    "source_type",     "product_name",     "battery_voltage",       "file_source"};
+	AddFitColumns(FIT_DEVICE_COLUMNS, return_types, names);
 
-	return_types = {LogicalType::UINTEGER, LogicalType::UBIGINT,  LogicalType::UTINYINT,  LogicalType::VARCHAR,
-	                LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::UBIGINT,   LogicalType::VARCHAR,
-	                LogicalType::VARCHAR,  LogicalType::UINTEGER, LogicalType::VARCHAR,   LogicalType::VARCHAR,
-	                LogicalType::VARCHAR,  LogicalType::UTINYINT, LogicalType::USMALLINT, LogicalType::VARCHAR,
-	                LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::DOUBLE,    LogicalType::VARCHAR};
-
-	return make_uniq<FitTableFunctionData>(file_path, "devices", &context);
+	auto result = make_uniq<FitTableFunctionData>(patterns, "devices", names, context, ParseScanOptions(input));
+	result->BindPartitionColumns(return_types, names);
+	return std::move(result);
 }
 
 static void FitDevicesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &data = (FitTableFunctionData &)*data_p.bind_data;
+	FitScanRows(FIT_DEVICE_COLUMNS, &FitDataCollector::devices, data_p, output);
+}
 
-	idx_t remaining_rows = data.fit_devices.size() - data.current_row;
-	idx_t rows_to_output = MinValue<idx_t>(remaining_rows, STANDARD_VECTOR_SIZE);
+// ===== FIT EVENTS TABLE FUNCTION =====
+static const FitColumn<FitEvent> FIT_EVENT_COLUMNS[] = {
+    FIT_COLUMN(FitEvent, event_id, UINTEGER, NEVER),
+    FIT_COLUMN(FitEvent, activity_id, UBIGINT, NEVER),
+    FIT_COLUMN(FitEvent, timestamp, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitEvent, event, VARCHAR, NEVER),
+    FIT_COLUMN(FitEvent, event_type, VARCHAR, NEVER),
+    FIT_COLUMN(FitEvent, data, UINTEGER, IF_ZERO),
+    FIT_COLUMN(FitEvent, data16, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitEvent, score, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitEvent, opponent_score, USMALLINT, IF_ZERO),
+    FIT_COLUMN(FitEvent, front_gear_num, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitEvent, front_gear, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitEvent, rear_gear_num, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitEvent, rear_gear, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitEvent, device_index, UTINYINT, NEVER),
+    FIT_COLUMN(FitEvent, activity_type, VARCHAR, NEVER),
+    FIT_COLUMN(FitEvent, start_timestamp, TIMESTAMP_TZ, NEVER),
+    FIT_COLUMN(FitEvent, file_source, VARCHAR, IF_ZERO),
+};
 
-	if (rows_to_output == 0) {
-		output.SetCardinality(0);
-		return;
+static unique_ptr<FunctionData> FitEventsBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+	auto patterns = GetFitFilePatterns(input.inputs[0]);
+
+	AddFitColumns(FIT_EVENT_COLUMNS, return_types, names);
+
+	auto result = make_uniq<FitTableFunctionData>(patterns, "events", names, context, ParseScanOptions(input));
+	result->BindPartitionColumns(return_types, names);
+	return std::move(result);
+}
+
+static void FitEventsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	FitScanRows(FIT_EVENT_COLUMNS, &FitDataCollector::events, data_p, output);
+}
+
+// ===== FIT USERS TABLE FUNCTION =====
+static const FitColumn<FitUser> FIT_USER_COLUMNS[] = {
+    FIT_COLUMN(FitUser, user_id, UINTEGER, NEVER),
+    FIT_COLUMN(FitUser, gender, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, age, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, height, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitUser, weight, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitUser, language, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, time_zone, TINYINT, NEVER),
+    FIT_COLUMN(FitUser, activity_class, DOUBLE, IF_NOT_POSITIVE),
+    FIT_COLUMN(FitUser, running_lactate_threshold_hr, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, cycling_lactate_threshold_hr, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, swimming_lactate_threshold_hr, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, default_max_running_hr, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, default_max_biking_hr, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, default_max_hr, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, hr_setting, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, speed_setting, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, dist_setting, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, power_setting, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, position_setting, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, temperature_setting, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, local_id, UINTEGER, IF_ZERO),
+    FIT_COLUMN(FitUser, global_id, UBIGINT, IF_ZERO),
+    FIT_COLUMN(FitUser, wake_time, UINTEGER, IF_ZERO),
+    FIT_COLUMN(FitUser, sleep_time, UINTEGER, IF_ZERO),
+    FIT_COLUMN(FitUser, height_setting, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, weight_setting, VARCHAR, NEVER),
+    FIT_COLUMN(FitUser, resting_heart_rate, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, default_max_swimming_hr, UTINYINT, IF_ZERO),
+    FIT_COLUMN(FitUser, file_source, VARCHAR, IF_ZERO),
+};
+
+static unique_ptr<FunctionData> FitUsersBind(ClientContext &context, TableFunctionBindInput &input,
+                                             vector<LogicalType> &return_types, vector<string> &names) {
+	auto patterns = GetFitFilePatterns(input.inputs[0]);
+
+	AddFitColumns(FIT_USER_COLUMNS, return_types, names);
+
+	auto result = make_uniq<FitTableFunctionData>(patterns, "users", names, context, ParseScanOptions(input));
+	result->BindPartitionColumns(return_types, names);
+	return std::move(result);
+}
+
+static void FitUsersFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	FitScanRows(FIT_USER_COLUMNS, &FitDataCollector::users, data_p, output);
+}
+
+inline void FitOpenSSLVersionScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
+	auto &name_vector = args.data[0];
+	UnaryExecutor::Execute<string_t, string_t>(name_vector, result, args.size(), [&](string_t name) {
+		return StringVector::AddString(result, "Fit " + name.GetString() + ", my linked OpenSSL version is " +
+		                                           OPENSSL_VERSION_TEXT);
+	});
+}
+
+// ===== SIDECARS =====
+// Bumped whenever the layout of a sidecar or the columns of a table change
+static constexpr uint32_t FIT_SIDECAR_VERSION = 1;
+static const char FIT_SIDECAR_MAGIC[4] = {'F', 'I', 'T', 'C'};
+
+template <class ROW, idx_t N>
+static void SaveFitRows(const FitColumn<ROW> (&columns)[N], const std::vector<ROW> &rows, FitSidecarWriter &writer) {
+	writer.Write<uint64_t>(rows.size());
+	writer.Write<uint64_t>(N);
+	for (auto &column : columns) {
+		column.save(rows, writer);
 	}
+}
 
-	// Fill the output chunk with device data
-	for (idx_t row = 0; row < rows_to_output; row++) {
-		const auto &fit_device = data.fit_devices[data.current_row + row];
-		idx_t col = 0;
-
-		output.SetValue(col++, row, Value::UINTEGER(fit_device.device_id));
-		output.SetValue(col++, row, Value::UBIGINT(fit_device.activity_id));
-		output.SetValue(col++, row, Value::UTINYINT(fit_device.device_index));
-		output.SetValue(col++, row, Value(fit_device.device_type));
-		output.SetValue(col++, row, Value(fit_device.manufacturer));
-		output.SetValue(col++, row, Value(fit_device.product));
-		output.SetValue(col++, row, fit_device.serial_number > 0 ? Value::UBIGINT(fit_device.serial_number) : Value());
-		output.SetValue(col++, row, Value(fit_device.software_version));
-		output.SetValue(col++, row, Value(fit_device.hardware_version));
-		output.SetValue(col++, row,
-		                fit_device.cum_operating_time > 0 ? Value::UINTEGER(fit_device.cum_operating_time) : Value());
-		output.SetValue(col++, row, Value(fit_device.battery_status));
-		output.SetValue(col++, row, Value(fit_device.sensor_position));
-		output.SetValue(col++, row, Value(fit_device.descriptor));
-		output.SetValue(col++, row,
-		                fit_device.ant_transmission_type > 0 ? Value::UTINYINT(fit_device.ant_transmission_type)
-		                                                     : Value());
-		output.SetValue(col++, row,
-		                fit_device.ant_device_number > 0 ? Value::USMALLINT(fit_device.ant_device_number) : Value());
-		output.SetValue(col++, row, Value(fit_device.ant_network));
-		output.SetValue(col++, row, Value(fit_device.source_type));
-		output.SetValue(col++, row, Value(fit_device.product_name));
-		output.SetValue(col++, row,
-		                fit_device.battery_voltage > 0.0 ? Value::DOUBLE(fit_device.battery_voltage) : Value());
+template <class ROW, idx_t N>
+static void LoadFitRows(const FitColumn<ROW> (&columns)[N], std::vector<ROW> &rows, FitSidecarReader &reader) {
+	auto row_count = reader.Read<uint64_t>();
+	if (row_count > reader.Remaining() || reader.Read<uint64_t>() != N) {
+		throw std::runtime_error("FIT sidecar columns do not match");
 	}
+	rows.resize(row_count);
+	for (auto &column : columns) {
+		column.load(rows, reader);
+	}
+}
 
-	output.SetCardinality(rows_to_output);
-	data.current_row += rows_to_output;
+// Writes the rows of a file decoded with FitDecodePlan::All(). Sidecars are only an
+// optimization: a sidecar that cannot be written is skipped.
+static void WriteFitSidecar(const string &sidecar_path, const FitFileKey &key, const FitDataCollector &collector) {
+	try {
+		FitSidecarWriter writer;
+		writer.WriteData(reinterpret_cast<const_data_ptr_t>(FIT_SIDECAR_MAGIC), sizeof(FIT_SIDECAR_MAGIC));
+		writer.Write<uint32_t>(FIT_SIDECAR_VERSION);
+		writer.WriteString(key.path);
+		writer.Write<uint64_t>(key.size);
+		writer.Write<int64_t>(key.modified_time);
+		writer.Write<uint8_t>(collector.crc_valid ? 1 : 0);
+		writer.WriteString(collector.record_activity_type);
+
+		auto &record_fields = collector.GetRecordFields();
+		writer.Write<uint64_t>(record_fields.size());
+		for (auto field : record_fields) {
+			writer.WriteString(field->name);
+		}
+		collector.records.Serialize(writer);
+
+		SaveFitRows(FIT_ACTIVITY_COLUMNS, collector.activities, writer);
+		SaveFitRows(FIT_SESSION_COLUMNS, collector.sessions, writer);
+		SaveFitRows(FIT_LAP_COLUMNS, collector.laps, writer);
+		SaveFitRows(FIT_DEVICE_COLUMNS, collector.devices, writer);
+		SaveFitRows(FIT_EVENT_COLUMNS, collector.events, writer);
+		SaveFitRows(FIT_USER_COLUMNS, collector.users, writer);
+
+		writer.Flush(sidecar_path);
+	} catch (const std::exception &) {
+		// Decoded again by the next scan
+	}
 }
 
-// ===== FIT EVENTS TABLE FUNCTION =====
-static unique_ptr<FunctionData> FitEventsBind(ClientContext &context, TableFunctionBindInput &input,
-                                              vector<LogicalType> &return_types, vector<string> &names) {
-	auto file_path = input.inputs[0].GetValue<string>();
+// Returns nullptr if there is no sidecar of this version of the file
+static shared_ptr<FitDataCollector> ReadFitSidecar(FileSystem &fs, const string &sidecar_path, const FitFileKey &key) {
+	try {
+		FitSidecarReader reader(fs, sidecar_path);
+		if (memcmp(reader.ReadData(sizeof(FIT_SIDECAR_MAGIC)), FIT_SIDECAR_MAGIC, sizeof(FIT_SIDECAR_MAGIC)) != 0 ||
+		    reader.Read<uint32_t>() != FIT_SIDECAR_VERSION) {
+			return nullptr;
+		}
+		FitFileKey sidecar_key;
+		sidecar_key.path = reader.ReadString();
+		sidecar_key.size = reader.Read<uint64_t>();
+		sidecar_key.modified_time = reader.Read<int64_t>();
+		if (!(sidecar_key == key)) {
+			// Sidecar of an older version of the file, or of another file with the same hash
+			return nullptr;
+		}
+		bool crc_valid = reader.Read<uint8_t>() != 0;
+		auto record_activity_type = reader.ReadString();
+
+		auto plan = FitDecodePlan::All();
+		if (reader.Read<uint64_t>() != plan.record_fields.size()) {
+			return nullptr;
+		}
+		for (auto field : plan.record_fields) {
+			if (reader.ReadString() != field->name) {
+				return nullptr;
+			}
+		}
+		auto collector = make_shared_ptr<FitDataCollector>(plan);
+		collector->SetCurrentFile(key.path);
+		collector->crc_valid = crc_valid;
+		collector->record_activity_type = record_activity_type;
+		collector->records.Deserialize(reader);
+
+		LoadFitRows(FIT_ACTIVITY_COLUMNS, collector->activities, reader);
+		LoadFitRows(FIT_SESSION_COLUMNS, collector->sessions, reader);
+		LoadFitRows(FIT_LAP_COLUMNS, collector->laps, reader);
+		LoadFitRows(FIT_DEVICE_COLUMNS, collector->devices, reader);
+		LoadFitRows(FIT_EVENT_COLUMNS, collector->events, reader);
+		LoadFitRows(FIT_USER_COLUMNS, collector->users, reader);
+		return collector;
+	} catch (const std::exception &) {
+		// Missing or truncated sidecar
+		return nullptr;
+	}
+}
 
-	// Define event columns based on FitEvent structure
-	names = {"event_id",  "activity_id",  "timestamp",      "event",           "event_type", "data",
-	         "data16",    "score",        "opponent_score", "front_gear_num",  "front_gear", "rear_gear_num",
-	         "rear_gear", "device_index", "activity_type",  "start_timestamp", "file_source"};
+// ===== FIT CACHE STATS TABLE FUNCTION =====
+struct FitCacheStatsState : public GlobalTableFunctionState {
+	bool finished = false;
+};
 
-	return_types = {LogicalType::UINTEGER,  LogicalType::UBIGINT,  LogicalType::TIMESTAMP_TZ, LogicalType::VARCHAR,
-	                LogicalType::VARCHAR,   LogicalType::UINTEGER, LogicalType::USMALLINT,    LogicalType::USMALLINT,
-	                LogicalType::USMALLINT, LogicalType::UTINYINT, LogicalType::UTINYINT,     LogicalType::UTINYINT,
-	                LogicalType::UTINYINT,  LogicalType::UTINYINT, LogicalType::VARCHAR,      LogicalType::TIMESTAMP_TZ,
-	                LogicalType::VARCHAR};
+static unique_ptr<FunctionData> FitCacheStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                  vector<LogicalType> &return_types, vector<string> &names) {
+	names = {"entries", "memory_usage", "memory_limit", "hits", "misses", "evictions", "hit_rate"};
+	return_types = {LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::UBIGINT,
+	                LogicalType::UBIGINT, LogicalType::UBIGINT, LogicalType::DOUBLE};
+	return make_uniq<TableFunctionData>();
+}
 
-	return make_uniq<FitTableFunctionData>(file_path, "events", &context);
+static unique_ptr<GlobalTableFunctionState> FitCacheStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<FitCacheStatsState>();
 }
 
-static void FitEventsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &data = (FitTableFunctionData &)*data_p.bind_data;
+// One row with the counters of the file cache since the extension was loaded
+static void FitCacheStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &state = data_p.global_state->Cast<FitCacheStatsState>();
+	if (state.finished) {
+		return;
+	}
+	auto stats = GetFitFileCache().GetStats();
+	idx_t lookups = stats.hits + stats.misses;
+	output.SetValue(0, 0, Value::UBIGINT(stats.entries));
+	output.SetValue(1, 0, Value::UBIGINT(stats.memory_usage));
+	output.SetValue(2, 0, Value::UBIGINT(stats.memory_limit));
+	output.SetValue(3, 0, Value::UBIGINT(stats.hits));
+	output.SetValue(4, 0, Value::UBIGINT(stats.misses));
+	output.SetValue(5, 0, Value::UBIGINT(stats.evictions));
+	output.SetValue(6, 0, lookups ? Value::DOUBLE((double)stats.hits / (double)lookups) : Value());
+	output.SetCardinality(1);
+	state.finished = true;
+}
 
-	idx_t remaining_rows = data.fit_events.size() - data.current_row;
-	idx_t rows_to_output = MinValue<idx_t>(remaining_rows, STANDARD_VECTOR_SIZE);
+// ===== FIT IMPORT TABLE FUNCTION =====
+struct FitImportData : public FitTableFunctionData {
+	string schema_name;
 
-	if (rows_to_output == 0) {
-		output.SetCardinality(0);
-		return;
+	FitImportData(vector<string> patterns, string schema_name_p, ClientContext &context, FitScanOptions options)
+	    : FitTableFunctionData(std::move(patterns), "import", {}, context, options),
+	      schema_name(std::move(schema_name_p)) {
 	}
+};
+
+struct FitImportState : public GlobalTableFunctionState {
+	bool finished = false;
+};
 
-	// Fill the output chunk with event data
-	for (idx_t row = 0; row < rows_to_output; row++) {
-		const auto &fit_event = data.fit_events[data.current_row + row];
-		idx_t col = 0;
-
-		output.SetValue(col++, row, Value::UINTEGER(fit_event.event_id));
-		output.SetValue(col++, row, Value::UBIGINT(fit_event.activity_id));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(fit_event.timestamp));
-		output.SetValue(col++, row, Value(fit_event.event));
-		output.SetValue(col++, row, Value(fit_event.event_type));
-		output.SetValue(col++, row, fit_event.data > 0 ? Value::UINTEGER(fit_event.data) : Value());
-		output.SetValue(col++, row, fit_event.data16 > 0 ? Value::USMALLINT(fit_event.data16) : Value());
-		output.SetValue(col++, row, fit_event.score > 0 ? Value::USMALLINT(fit_event.score) : Value());
-		output.SetValue(col++, row,
-		                fit_event.opponent_score > 0 ? Value::USMALLINT(fit_event.opponent_score) : Value());
-		output.SetValue(col++, row, fit_event.front_gear_num > 0 ? Value::UTINYINT(fit_event.front_gear_num) : Value());
-		output.SetValue(col++, row, fit_event.front_gear > 0 ? Value::UTINYINT(fit_event.front_gear) : Value());
-		output.SetValue(col++, row, fit_event.rear_gear_num > 0 ? Value::UTINYINT(fit_event.rear_gear_num) : Value());
-		output.SetValue(col++, row, fit_event.rear_gear > 0 ? Value::UTINYINT(fit_event.rear_gear) : Value());
-		output.SetValue(col++, row, Value::UTINYINT(fit_event.device_index));
-		output.SetValue(col++, row, Value(fit_event.activity_type));
-		output.SetValue(col++, row, Value::TIMESTAMPTZ(fit_event.start_timestamp));
+// Table of the target schema that fit_import appends the rows of one table function to
+struct FitImportTable {
+	string name;
+	vector<string> names;
+	vector<LogicalType> types;
+	unique_ptr<Appender> appender;
+	DataChunk chunk;
+	idx_t rows = 0;
+
+	template <class COLUMN, idx_t N>
+	FitImportTable(const char *name_p, const COLUMN (&columns)[N]) : name(name_p) {
+		AddFitColumns(columns, types, names);
 	}
 
-	output.SetCardinality(rows_to_output);
-	data.current_row += rows_to_output;
-}
+	// Creates the table unless it exists and opens its appender
+	void Open(ClientContext &context, Connection &connection, const string &schema_name) {
+		string sql = "CREATE TABLE IF NOT EXISTS " + KeywordHelper::WriteOptionallyQuoted(schema_name) + "." +
+		             KeywordHelper::WriteOptionallyQuoted(name) + " (";
+		for (idx_t i = 0; i < names.size(); i++) {
+			sql += (i > 0 ? ", " : "") + KeywordHelper::WriteOptionallyQuoted(names[i]) + " " + types[i].ToString();
+		}
+		sql += ")";
+		auto result = connection.Query(sql);
+		if (result->HasError()) {
+			result->ThrowError();
+		}
+		appender = make_uniq<Appender>(connection, schema_name, name);
+		chunk.Initialize(Allocator::Get(context), types);
+	}
 
-// ===== FIT USERS TABLE FUNCTION =====
-static unique_ptr<FunctionData> FitUsersBind(ClientContext &context, TableFunctionBindInput &input,
-                                             vector<LogicalType> &return_types, vector<string> &names) {
-	auto file_path = input.inputs[0].GetValue<string>();
-
-	// Define user columns based on FitUser structure
-	names = {"user_id",
-	         "gender",
-	         "age",
-	         "height",
-	         "weight",
-	         "language",
-	         "time_zone",
-	         "activity_class",
-	         "running_lactate_threshold_hr",
-	         "cycling_lactate_threshold_hr",
-	         "swimming_lactate_threshold_hr",
-	         "default_max_running_hr",
-	         "default_max_biking_hr",
-	         "default_max_hr",
-	         "hr_setting",
-	         "speed_setting",
-	         "dist_setting",
-	         "power_setting",
-	         "position_setting",
-	         "temperature_setting",
-	         "local_id",
-	         "global_id",
-	         "wake_time",
-	         "sleep_time",
-	         "height_setting",
-	         "weight_setting",
-	         "resting_heart_rate",
-	         "default_max_swimming_hr",
-	         "file_source"};
-
-	return_types = {LogicalType::UINTEGER, LogicalType::VARCHAR,  LogicalType::UTINYINT, LogicalType::DOUBLE,
-	                LogicalType::DOUBLE,   LogicalType::VARCHAR,  LogicalType::TINYINT,  LogicalType::DOUBLE,
-	                LogicalType::UTINYINT, LogicalType::UTINYINT, LogicalType::UTINYINT, LogicalType::UTINYINT,
-	                LogicalType::UTINYINT, LogicalType::UTINYINT, LogicalType::VARCHAR,  LogicalType::VARCHAR,
-	                LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::VARCHAR,
-	                LogicalType::UINTEGER, LogicalType::UBIGINT,  LogicalType::UINTEGER, LogicalType::UINTEGER,
-	                LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::UTINYINT, LogicalType::UTINYINT,
-	                LogicalType::VARCHAR};
-
-	return make_uniq<FitTableFunctionData>(file_path, "users", &context);
+	// Appends all rows, one chunk at a time, written by write(column_ids, offset, count, chunk)
+	template <class WRITE>
+	void Append(idx_t row_count, WRITE write) {
+		vector<column_t> column_ids;
+		for (idx_t i = 0; i < names.size(); i++) {
+			column_ids.push_back(i);
+		}
+		for (idx_t offset = 0; offset < row_count; offset += STANDARD_VECTOR_SIZE) {
+			idx_t count = MinValue<idx_t>(row_count - offset, STANDARD_VECTOR_SIZE);
+			chunk.Reset();
+			write(column_ids, offset, count, chunk);
+			chunk.SetCardinality(count);
+			appender->AppendDataChunk(chunk);
+		}
+		rows += row_count;
+	}
+};
+
+template <class ROW, idx_t N>
+static void AppendFitRows(FitImportTable &table, const FitColumn<ROW> (&columns)[N], const std::vector<ROW> &rows,
+                          const FitIdBase &id_base) {
+	table.Append(rows.size(), [&](const vector<column_t> &column_ids, idx_t offset, idx_t count, DataChunk &chunk) {
+		WriteFitRows(columns, rows, column_ids, offset, count, chunk);
+		AddFitIdBase(id_base, table.names, column_ids, count, chunk);
+	});
 }
 
-static void FitUsersFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
-	auto &data = (FitTableFunctionData &)*data_p.bind_data;
+static unique_ptr<FunctionData> FitImportBind(ClientContext &context, TableFunctionBindInput &input,
+                                              vector<LogicalType> &return_types, vector<string> &names) {
+	if (input.inputs[0].IsNull() || input.inputs[1].IsNull()) {
+		throw BinderException("fit_import expects file patterns and a schema name");
+	}
+	auto options = ParseScanOptions(input);
+	if (options.hive_partitioning) {
+		throw BinderException("fit_import does not support hive_partitioning, the imported tables have fixed columns");
+	}
+	if (!context.transaction.IsAutoCommit()) {
+		// The import commits on its own connection, a rollback of the caller could not undo it
+		throw BinderException("fit_import cannot run inside an explicit transaction, it commits on its own");
+	}
+	names = {"table_name", "rows"};
+	return_types = {LogicalType::VARCHAR, LogicalType::UBIGINT};
+	return make_uniq<FitImportData>(GetFitFilePatterns(input.inputs[0]), input.inputs[1].GetValue<string>(), context,
+	                                options);
+}
 
-	idx_t remaining_rows = data.fit_users.size() - data.current_row;
-	idx_t rows_to_output = MinValue<idx_t>(remaining_rows, STANDARD_VECTOR_SIZE);
+static unique_ptr<GlobalTableFunctionState> FitImportInit(ClientContext &context, TableFunctionInitInput &input) {
+	return make_uniq<FitImportState>();
+}
 
-	if (rows_to_output == 0) {
-		output.SetCardinality(0);
+// Decodes every file once and appends its rows to the seven tables of the target schema, all
+// in one transaction: either every file is imported or none is. The import runs on its own
+// connection, calls inside an explicit transaction are rejected at bind. Returns the rows
+// appended to each table.
+static void FitImportFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<FitImportData>();
+	auto &state = data_p.global_state->Cast<FitImportState>();
+	if (state.finished) {
 		return;
 	}
+	state.finished = true;
+
+	FitImportTable records("records", FIT_RECORD_COLUMNS);
+	FitImportTable activities("activities", FIT_ACTIVITY_COLUMNS);
+	FitImportTable sessions("sessions", FIT_SESSION_COLUMNS);
+	FitImportTable laps("laps", FIT_LAP_COLUMNS);
+	FitImportTable devices("devices", FIT_DEVICE_COLUMNS);
+	FitImportTable events("events", FIT_EVENT_COLUMNS);
+	FitImportTable users("users", FIT_USER_COLUMNS);
+	FitImportTable *tables[] = {&records, &activities, &sessions, &laps, &devices, &events, &users};
+
+	// Files are loaded like a scan of all columns of every table, through the file cache if enabled
+	FitScanGlobalState scan;
+	scan.plan = FitDecodePlan::All();
+	scan.plan.expand_components = bind_data.options.expand_components;
+	scan.file_count = bind_data.files.size();
+	scan.fs = FileSystem::GetFileSystem(context);
+	scan.interrupted = &context.interrupted;
+
+	Connection connection(*context.db);
+	connection.BeginTransaction();
+	try {
+		auto result = connection.Query("CREATE SCHEMA IF NOT EXISTS " +
+		                               KeywordHelper::WriteOptionallyQuoted(bind_data.schema_name));
+		if (result->HasError()) {
+			result->ThrowError();
+		}
+		for (auto table : tables) {
+			table->Open(context, connection, bind_data.schema_name);
+		}
+
+		// Ids number the rows of all files, as in a scan
+		FitIdBase id_base;
+		for (auto &file_path : bind_data.files) {
+			shared_ptr<const FitDataCollector> collector;
+			try {
+				collector = scan.LoadFile(bind_data, file_path);
+			} catch (const InterruptException &) {
+				throw;
+			} catch (const std::exception &e) {
+				throw std::runtime_error("Error reading FIT files: " + string(e.what()));
+			}
+			if (!collector) {
+				continue;
+			}
+			records.Append(collector->records.size(),
+			               [&](const vector<column_t> &column_ids, idx_t offset, idx_t count, DataChunk &chunk) {
+				               WriteFitRecords(*collector, column_ids, offset, count, chunk);
+			               });
+			AppendFitRows(activities, FIT_ACTIVITY_COLUMNS, collector->activities, id_base);
+			AppendFitRows(sessions, FIT_SESSION_COLUMNS, collector->sessions, id_base);
+			AppendFitRows(laps, FIT_LAP_COLUMNS, collector->laps, id_base);
+			AppendFitRows(devices, FIT_DEVICE_COLUMNS, collector->devices, id_base);
+			AppendFitRows(events, FIT_EVENT_COLUMNS, collector->events, id_base);
+			AppendFitRows(users, FIT_USER_COLUMNS, collector->users, id_base);
+			id_base.Add(*collector);
+		}
+
+		for (auto table : tables) {
+			table->appender->Close();
+		}
+		connection.Commit();
+	} catch (...) {
+		if (connection.HasActiveTransaction()) {
+			connection.Rollback();
+		}
+		throw;
+	}
 
-	// Fill the output chunk with user data
-	for (idx_t row = 0; row < rows_to_output; row++) {
-		const auto &fit_user = data.fit_users[data.current_row + row];
-		idx_t col = 0;
-
-		output.SetValue(col++, row, Value::UINTEGER(fit_user.user_id));
-		output.SetValue(col++, row, Value(fit_user.gender));
-		output.SetValue(col++, row, fit_user.age > 0 ? Value::UTINYINT(fit_user.age) : Value());
-		output.SetValue(col++, row, fit_user.height > 0.0 ? Value::DOUBLE(fit_user.height) : Value());
-		output.SetValue(col++, row, fit_user.weight > 0.0 ? Value::DOUBLE(fit_user.weight) : Value());
-		output.SetValue(col++, row, Value(fit_user.language));
-		output.SetValue(col++, row, Value::TINYINT(fit_user.time_zone));
-		output.SetValue(col++, row, fit_user.activity_class > 0.0 ? Value::DOUBLE(fit_user.activity_class) : Value());
-		output.SetValue(col++, row,
-		                fit_user.running_lactate_threshold_hr > 0
-		                    ? Value::UTINYINT(fit_user.running_lactate_threshold_hr)
-		                    : Value());
-		output.SetValue(col++, row,
-		                fit_user.cycling_lactate_threshold_hr > 0
-		                    ? Value::UTINYINT(fit_user.cycling_lactate_threshold_hr)
-		                    : Value());
-		output.SetValue(col++, row,
-		                fit_user.swimming_lactate_threshold_hr > 0
-		                    ? Value::UTINYINT(fit_user.swimming_lactate_threshold_hr)
-		                    : Value());
-		output.SetValue(col++, row,
-		                fit_user.default_max_running_hr > 0 ? Value::UTINYINT(fit_user.default_max_running_hr)
-		                                                    : Value());
-		output.SetValue(col++, row,
-		                fit_user.default_max_biking_hr > 0 ? Value::UTINYINT(fit_user.default_max_biking_hr) : Value());
-		output.SetValue(col++, row, fit_user.default_max_hr > 0 ? Value::UTINYINT(fit_user.default_max_hr) : Value());
-		output.SetValue(col++, row, Value(fit_user.hr_setting));
-		output.SetValue(col++, row, Value(fit_user.speed_setting));
-		output.SetValue(col++, row, Value(fit_user.dist_setting));
-		output.SetValue(col++, row, Value(fit_user.power_setting));
-		output.SetValue(col++, row, Value(fit_user.position_setting));
-		output.SetValue(col++, row, Value(fit_user.temperature_setting));
-		output.SetValue(col++, row, fit_user.local_id > 0 ? Value::UINTEGER(fit_user.local_id) : Value());
-		output.SetValue(col++, row, fit_user.global_id > 0 ? Value::UBIGINT(fit_user.global_id) : Value());
-		output.SetValue(col++, row, fit_user.wake_time > 0 ? Value::UINTEGER(fit_user.wake_time) : Value());
-		output.SetValue(col++, row, fit_user.sleep_time > 0 ? Value::UINTEGER(fit_user.sleep_time) : Value());
-		output.SetValue(col++, row, Value(fit_user.height_setting));
-		output.SetValue(col++, row, Value(fit_user.weight_setting));
-		output.SetValue(col++, row,
-		                fit_user.resting_heart_rate > 0 ? Value::UTINYINT(fit_user.resting_heart_rate) : Value());
-		output.SetValue(col++, row,
-		                fit_user.default_max_swimming_hr > 0 ? Value::UTINYINT(fit_user.default_max_swimming_hr)
-		                                                     : Value());
+	idx_t row = 0;
+	for (auto table : tables) {
+		output.SetValue(0, row, Value(table->name));
+		output.SetValue(1, row, Value::UBIGINT(table->rows));
+		row++;
 	}
+	output.SetCardinality(row);
+}
 
-	output.SetCardinality(rows_to_output);
-	data.current_row += rows_to_output;
+// Rows of a scan, counted by earlier decodes of its files or estimated from their sizes. Large
+// globs are estimated from a sample of their files.
+static unique_ptr<NodeStatistics> FitCardinality(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<FitTableFunctionData>();
+	auto table = GetFitTableIndex(bind_data.table_type);
+	auto &files = bind_data.files;
+	auto &fs = FileSystem::GetFileSystem(context);
+	auto &index = GetFitFileStatistics();
+
+	static constexpr idx_t SAMPLE_SIZE = 64;
+	idx_t sample_size = MinValue<idx_t>(files.size(), SAMPLE_SIZE);
+	bool exact = sample_size == files.size();
+	idx_t sampled = 0;
+	idx_t rows = 0;
+	for (idx_t i = 0; i < sample_size; i++) {
+		FitFileKey key;
+		if (!GetFitFileKey(fs, files[i * files.size() / sample_size], key)) {
+			exact = false;
+			continue;
+		}
+		FitFileStatistics statistics;
+		if (index.Get(key, statistics) && statistics.rows[table] != DConstants::INVALID_INDEX) {
+			rows += statistics.rows[table];
+		} else {
+			rows += EstimateFitRows(fs, bind_data.table_type, key);
+			exact = false;
+		}
+		sampled++;
+	}
+	if (sampled == 0) {
+		return files.empty() ? make_uniq<NodeStatistics>(0, 0) : nullptr;
+	}
+	idx_t estimate = rows * files.size() / sampled;
+	return exact ? make_uniq<NodeStatistics>(estimate, estimate) : make_uniq<NodeStatistics>(estimate);
 }
 
-inline void FitOpenSSLVersionScalarFun(DataChunk &args, ExpressionState &state, Vector &result) {
-	auto &name_vector = args.data[0];
-	UnaryExecutor::Execute<string_t, string_t>(name_vector, result, args.size(), [&](string_t name) {
-		return StringVector::AddString(result, "Fit " + name.GetString() + ", my linked OpenSSL version is " +
-		                                           OPENSSL_VERSION_TEXT);
-	});
+// Min/max of the timestamp and the major metrics of fit_records, once every file was decoded
+static unique_ptr<BaseStatistics> FitStatistics(ClientContext &context, const FunctionData *bind_data_p,
+                                                column_t column_index) {
+	auto &bind_data = bind_data_p->Cast<FitTableFunctionData>();
+	if (bind_data.table_type != "records" || column_index >= FIT_RECORD_COLUMN_COUNT) {
+		return nullptr;
+	}
+	auto &column = FIT_RECORD_COLUMNS[column_index];
+	auto statistics_index = GetFitRecordStatisticsIndex(column);
+	FitValueRange range;
+	if (statistics_index == DConstants::INVALID_INDEX ||
+	    !bind_data.GetRecordValueRange(context, statistics_index, range) || !range.has_values) {
+		return nullptr;
+	}
+	auto statistics = NumericStats::CreateUnknown(LogicalType(column.type));
+	NumericStats::SetMin(statistics, GetFitRecordColumnValue(column, range.min));
+	NumericStats::SetMax(statistics, GetFitRecordColumnValue(column, range.max));
+	return statistics.ToUnique();
+}
+
+static double FitScanProgress(ClientContext &context, const FunctionData *bind_data_p,
+                              const GlobalTableFunctionState *global_state) {
+	return global_state->Cast<FitScanGlobalState>().GetProgress();
+}
+
+// Table functions over a file pattern or a list of file patterns
+static TableFunctionSet FitScanFunction(const string &name, table_function_t function, table_function_bind_t bind) {
+	TableFunctionSet result(name);
+	for (auto &input_type : vector<LogicalType> {LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR)}) {
+		TableFunction scan(name, {input_type}, function, bind, FitInitGlobal, FitInitLocal);
+		scan.projection_pushdown = true;
+		scan.get_partition_data = FitGetPartitionData;
+		scan.pushdown_complex_filter = FitPushdownComplexFilter;
+		scan.cardinality = FitCardinality;
+		scan.statistics = FitStatistics;
+		scan.table_scan_progress = FitScanProgress;
+		AddScanParameters(scan);
+		result.AddFunction(scan);
+	}
+	return result;
 }
 
 static void LoadInternal(ExtensionLoader &loader) {
 	// Register the 7 FIT table functions corresponding to the 7 tables in documentation
 
 	// 1. Time-series records table (original 'fit' function)
-	TableFunction fit_records_function("fit_records", {LogicalType::VARCHAR}, FitTableFunction, FitTableBind);
-	loader.RegisterFunction(fit_records_function);
+	loader.RegisterFunction(FitScanFunction("fit_records", FitTableFunction, FitTableBind));
 
 	// Keep original 'fit' function name for backward compatibility
-	TableFunction fit_table_function("fit", {LogicalType::VARCHAR}, FitTableFunction, FitTableBind);
-	loader.RegisterFunction(fit_table_function);
+	loader.RegisterFunction(FitScanFunction("fit", FitTableFunction, FitTableBind));
 
 	// 2. Activities metadata table
-	TableFunction fit_activities_function("fit_activities", {LogicalType::VARCHAR}, FitActivitiesFunction,
-	                                      FitActivitiesBind);
-	loader.RegisterFunction(fit_activities_function);
+	loader.RegisterFunction(FitScanFunction("fit_activities", FitActivitiesFunction, FitActivitiesBind));
 
 	// 3. Sessions table
-	TableFunction fit_sessions_function("fit_sessions", {LogicalType::VARCHAR}, FitSessionsFunction, FitSessionsBind);
-	loader.RegisterFunction(fit_sessions_function);
+	loader.RegisterFunction(FitScanFunction("fit_sessions", FitSessionsFunction, FitSessionsBind));
 
 	// 4. Laps table
-	TableFunction fit_laps_function("fit_laps", {LogicalType::VARCHAR}, FitLapsFunction, FitLapsBind);
-	loader.RegisterFunction(fit_laps_function);
+	loader.RegisterFunction(FitScanFunction("fit_laps", FitLapsFunction, FitLapsBind));
 
 	// 5. Device information table
-	TableFunction fit_devices_function("fit_devices", {LogicalType::VARCHAR}, FitDevicesFunction, FitDevicesBind);
-	loader.RegisterFunction(fit_devices_function);
+	loader.RegisterFunction(FitScanFunction("fit_devices", FitDevicesFunction, FitDevicesBind));
 
 	// 6. Events table
-	TableFunction fit_events_function("fit_events", {LogicalType::VARCHAR}, FitEventsFunction, FitEventsBind);
-	loader.RegisterFunction(fit_events_function);
+	loader.RegisterFunction(FitScanFunction("fit_events", FitEventsFunction, FitEventsBind));
 
 	// 7. User profile table
-	TableFunction fit_users_function("fit_users", {LogicalType::VARCHAR}, FitUsersFunction, FitUsersBind);
-	loader.RegisterFunction(fit_users_function);
+	loader.RegisterFunction(FitScanFunction("fit_users", FitUsersFunction, FitUsersBind));
+
+	// Single decode import of all tables into a schema, e.g. CALL fit_import('archive/*.fit', 'fit')
+	TableFunctionSet import_functions("fit_import");
+	for (auto &input_type : vector<LogicalType> {LogicalType::VARCHAR, LogicalType::LIST(LogicalType::VARCHAR)}) {
+		TableFunction import_function("fit_import", {input_type, LogicalType::VARCHAR}, FitImportFunction,
+		                              FitImportBind, FitImportInit);
+		AddScanParameters(import_function);
+		import_functions.AddFunction(import_function);
+	}
+	loader.RegisterFunction(import_functions);
+
+	// Decoded file cache shared by all of the above
+	loader.RegisterFunction(
+	    TableFunction("fit_cache_stats", {}, FitCacheStatsFunction, FitCacheStatsBind, FitCacheStatsInit));
+	auto &config = DBConfig::GetConfig(loader.GetDatabaseInstance());
+	config.AddExtensionOption("fit_cache_memory_limit",
+	                          "Memory budget of the cache of decoded FIT files shared by all FIT table functions, "
+	                          "e.g. '512MB'. 0 disables the cache",
+	                          LogicalType::VARCHAR, Value("0"), SetFitCacheMemoryLimit);
+	config.AddExtensionOption("fit_cache_directory",
+	                          "Directory where decoded FIT files are kept as sidecar files read by later scans "
+	                          "instead of the FIT files. Empty disables sidecars",
+	                          LogicalType::VARCHAR, Value(""));
 
 	// Register scalar function
 	auto fit_openssl_version_scalar_function =
@@ -0,0 +1,345 @@
+#include "fit_field_extractor.hpp"
+#include "fit_profile.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace duckdb {
+
+static bool IsPlainIntegerType(FIT_UINT8 type) {
+	switch (type & FIT_BASE_TYPE_NUM_MASK) {
+	case FIT_BASE_TYPE_ENUM & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_SINT8 & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_UINT8 & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_SINT16 & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_UINT16 & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_SINT32 & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_UINT32 & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_UINT8Z & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_UINT16Z & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_UINT32Z & FIT_BASE_TYPE_NUM_MASK:
+	case FIT_BASE_TYPE_BYTE & FIT_BASE_TYPE_NUM_MASK:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool IsSignedType(FIT_UINT8 type) {
+	FIT_UINT8 num = type & FIT_BASE_TYPE_NUM_MASK;
+	return num == (FIT_BASE_TYPE_SINT8 & FIT_BASE_TYPE_NUM_MASK) ||
+	       num == (FIT_BASE_TYPE_SINT16 & FIT_BASE_TYPE_NUM_MASK) ||
+	       num == (FIT_BASE_TYPE_SINT32 & FIT_BASE_TYPE_NUM_MASK);
+}
+
+static FIT_UINT32 ReadValue(const FIT_UINT8 *data, FIT_UINT8 size, bool swap) {
+	FIT_UINT32 value = 0;
+	if (swap) {
+		for (FIT_UINT8 i = 0; i < size; i++) {
+			value = (value << 8) | data[i];
+		}
+	} else {
+		for (FIT_UINT8 i = size; i > 0; i--) {
+			value = (value << 8) | data[i - 1];
+		}
+	}
+	return value;
+}
+
+static bool IsInvalidValue(FIT_UINT32 value, FIT_UINT8 type) {
+	FIT_UINT8 num = type & FIT_BASE_TYPE_NUM_MASK;
+	return value == ReadValue(fit::baseTypeInvalids[num], fit::baseTypeSizes[num], false);
+}
+
+static double ToRawValue(FIT_UINT32 value, FIT_UINT8 type) {
+	if (!IsSignedType(type)) {
+		return (double)value;
+	}
+	FIT_UINT8 bits = fit::baseTypeSizes[type & FIT_BASE_TYPE_NUM_MASK] * 8;
+	if (bits < 32 && (value & (1u << (bits - 1)))) {
+		value |= ~((1u << bits) - 1);
+	}
+	return (double)(FIT_SINT32)value;
+}
+
+static bool IsInvalidRawValue(FIT_FLOAT64 raw) {
+	return memcmp(&raw, fit::baseTypeInvalids[FIT_BASE_TYPE_FLOAT64 & FIT_BASE_TYPE_NUM_MASK], sizeof(raw)) == 0;
+}
+
+// True if the components of the field, or the components of the fields they expand into, expand
+// into one of the fields
+static bool ExpandsInto(FIT_UINT16 mesg_num, const fit::Profile::FIELD &field, const vector<FIT_UINT8> &field_nums,
+                        idx_t depth = 0) {
+	// The profile has no cycles, the depth only guards against a broken one
+	if (depth > 8) {
+		return false;
+	}
+	auto expands = [&](const fit::Profile::FIELD_COMPONENT *components, FIT_UINT16 count) {
+		for (FIT_UINT16 i = 0; i < count; i++) {
+			if (components[i].num == FIT_FIELD_NUM_INVALID) {
+				continue;
+			}
+			if (std::find(field_nums.begin(), field_nums.end(), components[i].num) != field_nums.end()) {
+				return true;
+			}
+			const fit::Profile::FIELD *target = fit::Profile::GetField(mesg_num, components[i].num);
+			if (target && ExpandsInto(mesg_num, *target, field_nums, depth + 1)) {
+				return true;
+			}
+		}
+		return false;
+	};
+	if (expands(field.components, field.numComponents)) {
+		return true;
+	}
+	for (FIT_UINT16 i = 0; i < field.numSubFields; i++) {
+		if (expands(field.subFields[i].components, field.subFields[i].numComponents)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+FitFieldExtractor::FitFieldExtractor(FIT_UINT16 mesg_num, vector<FIT_UINT8> field_nums_p)
+    : mesg_num(mesg_num), field_nums(std::move(field_nums_p)), timestamp_slot(DConstants::INVALID_INDEX),
+      expand_components(true) {
+	for (idx_t slot = 0; slot < field_nums.size(); slot++) {
+		if (field_nums[slot] == FIT_FIELD_NUM_TIMESTAMP) {
+			timestamp_slot = slot;
+		}
+	}
+}
+
+void FitFieldExtractor::AddFilter(idx_t slot, double raw_min, double raw_max) {
+	for (auto &filter : filters) {
+		if (filter.slot == slot) {
+			filter.raw_min = MaxValue(filter.raw_min, raw_min);
+			filter.raw_max = MinValue(filter.raw_max, raw_max);
+			return;
+		}
+	}
+	filters.push_back({slot, raw_min, raw_max});
+}
+
+bool FitFieldExtractor::GetRawRange(FIT_UINT16 mesg_num, FIT_UINT8 field_num, double &raw_min, double &raw_max) {
+	const fit::Profile::FIELD *field = fit::Profile::GetField(mesg_num, field_num);
+	if (!field || (field->type & FIT_BASE_TYPE_NUM_MASK) >= FIT_BASE_TYPES || !IsPlainIntegerType(field->type)) {
+		return false;
+	}
+	FIT_UINT8 bits = fit::baseTypeSizes[field->type & FIT_BASE_TYPE_NUM_MASK] * 8;
+	if (IsSignedType(field->type)) {
+		raw_min = -std::ldexp(1.0, bits - 1);
+		raw_max = std::ldexp(1.0, bits - 1) - 1;
+	} else {
+		raw_min = 0;
+		raw_max = std::ldexp(1.0, bits) - 1;
+	}
+	return true;
+}
+
+void FitFieldExtractor::ApplyFilter(FieldRead &read) const {
+	read.filtered = false;
+	for (auto &filter : filters) {
+		if (filter.slot == read.slot) {
+			read.filtered = true;
+			read.raw_min = filter.raw_min;
+			read.raw_max = filter.raw_max;
+		}
+	}
+}
+
+bool FitFieldExtractor::HasFilteredFields(const bool *valid) const {
+	for (auto &filter : filters) {
+		if (!valid[filter.slot]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FitFieldExtractor::Compile(const fit::MesgDefinition &definition, bool big_endian) {
+	auto &plan = plans[definition.GetLocalNum()];
+	plan.clear();
+
+	if (definition.GetNum() != mesg_num) {
+		return false;
+	}
+
+	vector<FieldRead> expansions;
+	vector<bool> has_direct(field_nums.size(), false);
+	FIT_UINT32 data_offset = 0;
+
+	for (auto &field_def : definition.GetFields()) {
+		FIT_UINT32 field_offset = data_offset;
+		data_offset += field_def.GetSize();
+
+		// Unknown fields and base types are ignored by the decoder as well
+		const fit::Profile::FIELD *field = fit::Profile::GetField(mesg_num, field_def.GetNum());
+		FIT_UINT8 def_type_num = field_def.GetType() & FIT_BASE_TYPE_NUM_MASK;
+		if (!field || def_type_num >= FIT_BASE_TYPES) {
+			continue;
+		}
+
+		// Subfield components depend on the message contents and accumulated components on
+		// the decoder state, leave those to the decoded message
+		for (FIT_UINT16 i = 0; i < field->numSubFields; i++) {
+			if (field->subFields[i].numComponents > 0) {
+				return false;
+			}
+		}
+		for (FIT_UINT16 i = 0; i < field->numComponents; i++) {
+			if (field->components[i].accumulate) {
+				return false;
+			}
+		}
+
+		// Same type promotion rules as fit::Decode: smaller types are read as they are,
+		// a different type of the same size is read as the profile type
+		FIT_UINT8 type = field->type;
+		FIT_UINT8 type_size = fit::baseTypeSizes[type & FIT_BASE_TYPE_NUM_MASK];
+		if (field_def.GetType() != field->type) {
+			FIT_UINT8 def_type_size = fit::baseTypeSizes[def_type_num];
+			if (def_type_size < type_size) {
+				type = field_def.GetType();
+				type_size = def_type_size;
+			} else if (def_type_size != type_size) {
+				continue;
+			}
+		}
+		bool swap = big_endian && type_size > 1 && (field_def.GetType() & FIT_BASE_TYPE_ENDIAN_FLAG) != 0;
+		bool plain = IsPlainIntegerType(type) && field_def.GetSize() == type_size;
+
+		for (idx_t slot = 0; slot < field_nums.size(); slot++) {
+			if (field_nums[slot] != field_def.GetNum() || slot == timestamp_slot) {
+				continue;
+			}
+			if (!plain || has_direct[slot]) {
+				return false;
+			}
+			has_direct[slot] = true;
+			plan.push_back({slot, field_offset, type, type_size, swap, 0, 0, false, 1.0, 0.0, type, field->scale,
+			                field->offset});
+		}
+
+		FIT_UINT16 bit_offset = 0;
+		for (FIT_UINT16 i = 0; expand_components && i < field->numComponents; i++) {
+			const fit::Profile::FIELD_COMPONENT &component = field->components[i];
+			const fit::Profile::FIELD *target = fit::Profile::GetField(mesg_num, component.num);
+			if (component.num != FIT_FIELD_NUM_INVALID && target && ExpandsInto(mesg_num, *target, field_nums)) {
+				// Nested components (compressed_speed_distance to speed to enhanced_speed) are left to
+				// the decoded message
+				return false;
+			}
+			for (idx_t slot = 0; slot < field_nums.size(); slot++) {
+				if (component.num == FIT_FIELD_NUM_INVALID || field_nums[slot] != component.num ||
+				    slot == timestamp_slot) {
+					continue;
+				}
+				if (!plain || !target || target->numComponents > 0 || target->numSubFields > 0 ||
+				    !IsPlainIntegerType(target->type) || component.bits == 0 ||
+				    bit_offset + component.bits > type_size * 8) {
+					return false;
+				}
+				expansions.push_back({slot, field_offset, type, type_size, swap, (FIT_UINT8)bit_offset,
+				                      component.bits, IsSignedType(target->type), component.scale, component.offset,
+				                      target->type, target->scale, target->offset});
+			}
+			bit_offset += component.bits;
+		}
+	}
+
+	plan.insert(plan.end(), expansions.begin(), expansions.end());
+
+	// Filtered fields are read first so that dropped messages are left at their first field out
+	// of range. Direct reads of a slot stay before its expansions.
+	for (auto &read : plan) {
+		ApplyFilter(read);
+	}
+	std::stable_partition(plan.begin(), plan.end(), [](const FieldRead &read) { return read.filtered; });
+	return true;
+}
+
+bool FitFieldExtractor::Extract(FIT_UINT8 local_num, const FIT_UINT8 *data, FIT_UINT32 timestamp, double *values,
+                                bool *valid) const {
+	std::fill(valid, valid + field_nums.size(), false);
+
+	for (auto &read : plans[local_num]) {
+		if (valid[read.slot]) {
+			continue;
+		}
+
+		FIT_UINT32 value = ReadValue(data + read.data_offset, read.size, read.swap);
+		if (IsInvalidValue(value, read.type)) {
+			continue;
+		}
+
+		double raw;
+		if (read.bits == 0) {
+			raw = ToRawValue(value, read.type);
+		} else {
+			// Expand the component into the target field the way fit::Decode does, rounding
+			// the expanded value to the target type before it is scaled back
+			FIT_UINT32 bits_value = read.bits < 32 ? (value >> read.bit_offset) & ((1u << read.bits) - 1) : value;
+			if (read.bits == 32 && bits_value == FIT_UINT32_INVALID) {
+				continue;
+			}
+			double bits = (double)bits_value;
+			if (read.bits_signed && read.bits < 32 && (bits_value & (1u << (read.bits - 1)))) {
+				bits = (double)((FIT_SINT32)(bits_value & ((1u << (read.bits - 1)) - 1)) -
+				                (FIT_SINT32)(1u << (read.bits - 1)));
+			}
+			double expanded = ((bits / read.component_scale) - read.component_offset + read.value_offset) * read.scale;
+			expanded = expanded > 0.0 ? std::floor(expanded + 0.5) : std::ceil(expanded - 0.5);
+
+			FIT_UINT8 target_size = fit::baseTypeSizes[read.target_type & FIT_BASE_TYPE_NUM_MASK];
+			FIT_UINT32 stored = (FIT_UINT32)(int64_t)expanded;
+			if (target_size < 4) {
+				stored &= (1u << (target_size * 8)) - 1;
+			}
+			if (IsInvalidValue(stored, read.target_type)) {
+				continue;
+			}
+			raw = ToRawValue(stored, read.target_type);
+		}
+
+		if (read.filtered && (raw < read.raw_min || raw > read.raw_max)) {
+			return false;
+		}
+		values[read.slot] = raw / read.scale - read.value_offset;
+		valid[read.slot] = true;
+	}
+
+	if (timestamp_slot != DConstants::INVALID_INDEX && timestamp != FIT_DATE_TIME_INVALID) {
+		values[timestamp_slot] = (double)timestamp;
+		valid[timestamp_slot] = true;
+	}
+	return HasFilteredFields(valid);
+}
+
+bool FitFieldExtractor::Extract(const fit::Mesg &mesg, double *values, bool *valid) const {
+	for (idx_t slot = 0; slot < field_nums.size(); slot++) {
+		valid[slot] = false;
+
+		const fit::Field *field = mesg.GetField(field_nums[slot]);
+		if (!field || field->GetNumValues() == 0) {
+			continue;
+		}
+
+		FIT_FLOAT64 raw = field->GetRawValue(0);
+		if (IsInvalidRawValue(raw)) {
+			continue;
+		}
+
+		for (auto &filter : filters) {
+			if (filter.slot == slot && (raw < filter.raw_min || raw > filter.raw_max)) {
+				return false;
+			}
+		}
+		values[slot] = raw / field->GetScale() - field->GetOffset();
+		valid[slot] = true;
+	}
+	return HasFilteredFields(valid);
+}
+
+} // namespace duckdb
@@ -0,0 +1,178 @@
+#include "fit_file_buffer.hpp"
+#include "fit_crc.hpp"
+
+#include <cerrno>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <sys/stat.h>
+#include <sys/types.h>
+#endif
+
+namespace duckdb {
+
+FitFileBuffer::FitFileBuffer(FileSystem &fs, const string &path) : data(nullptr), size(0), mapping(nullptr) {
+	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+	// The file system may have expanded the path (~/, file://), the open handle is read then
+	if (handle->OnDiskFile() && Map(path)) {
+		return;
+	}
+	Read(*handle);
+}
+
+bool FitFileBuffer::Map(const string &path) {
+#ifndef _WIN32
+	int fd = open(path.c_str(), O_RDONLY);
+	if (fd < 0) {
+		return false;
+	}
+
+	struct stat file_stat;
+	if (fstat(fd, &file_stat) != 0) {
+		close(fd);
+		return false;
+	}
+	if (S_ISDIR(file_stat.st_mode)) {
+		close(fd);
+		throw std::runtime_error("Cannot open FIT file: " + path);
+	}
+	if (!S_ISREG(file_stat.st_mode)) {
+		// Not a regular file: leave it to the caller
+		close(fd);
+		return false;
+	}
+
+	size = (idx_t)file_stat.st_size;
+	if (size > 0) {
+		void *addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (addr != MAP_FAILED) {
+			madvise(addr, size, MADV_SEQUENTIAL);
+			mapping = addr;
+			data = (const uint8_t *)addr;
+		} else {
+			// Mapping not supported by the underlying file system, read everything at once
+			contents.resize(size);
+			idx_t total = 0;
+			while (total < size) {
+				ssize_t bytes = read(fd, contents.data() + total, size - total);
+				if (bytes < 0 && errno == EINTR) {
+					continue;
+				}
+				if (bytes <= 0) {
+					break;
+				}
+				total += (idx_t)bytes;
+			}
+			contents.resize(total);
+			size = total;
+			data = contents.data();
+		}
+	}
+
+	close(fd);
+	return true;
+#else
+	struct _stat64 file_stat;
+	if (_stat64(path.c_str(), &file_stat) != 0) {
+		return false;
+	}
+	if ((file_stat.st_mode & _S_IFMT) == _S_IFDIR) {
+		throw std::runtime_error("Cannot open FIT file: " + path);
+	}
+	if ((file_stat.st_mode & _S_IFMT) != _S_IFREG) {
+		// Not a regular file: leave it to the caller
+		return false;
+	}
+
+	std::ifstream file(path, std::ios::in | std::ios::binary);
+	if (!file.is_open()) {
+		return false;
+	}
+
+	contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	size = contents.size();
+	data = contents.data();
+	return true;
+#endif
+}
+
+void FitFileBuffer::Read(FileHandle &handle) {
+	if (handle.CanSeek()) {
+		contents.resize(handle.GetFileSize());
+		handle.Read(contents.data(), contents.size(), 0);
+	} else {
+		// Pipes have no size, read them to the end
+		const idx_t read_size = 1 << 16;
+		idx_t total = 0;
+		while (true) {
+			contents.resize(total + read_size);
+			auto bytes = handle.Read(contents.data() + total, read_size);
+			if (bytes <= 0) {
+				break;
+			}
+			total += (idx_t)bytes;
+		}
+		contents.resize(total);
+	}
+	size = contents.size();
+	data = contents.data();
+}
+
+FitFileBuffer::~FitFileBuffer() {
+#ifndef _WIN32
+	if (mapping) {
+		munmap(mapping, size);
+	}
+#endif
+}
+
+bool FitFileBuffer::VerifyCrc() const {
+	idx_t offset = 0;
+	while (offset + FIT_HEADER_SIZE_NO_CRC <= size) {
+		const uint8_t *header = data + offset;
+		idx_t header_size = header[0];
+		idx_t data_size = (idx_t)header[4] | ((idx_t)header[5] << 8) | ((idx_t)header[6] << 16) |
+		                  ((idx_t)header[7] << 24);
+
+		if (header_size < FIT_HEADER_SIZE_NO_CRC || data_size == 0) {
+			break;
+		}
+
+		idx_t file_size = header_size + data_size + 2;
+		if (offset + file_size > size) {
+			break;
+		}
+
+		// The CRC over a whole file including its trailing CRC is zero
+		if (fit::CRC::Update16(0, header, (FIT_UINT32)file_size) != 0) {
+			return false;
+		}
+		offset += file_size;
+	}
+	return true;
+}
+
+bool FitFileBuffer::IsComplete() const {
+	idx_t offset = 0;
+	while (offset + FIT_HEADER_SIZE_NO_CRC <= size) {
+		const uint8_t *header = data + offset;
+		idx_t header_size = header[0];
+		idx_t data_size = (idx_t)header[4] | ((idx_t)header[5] << 8) | ((idx_t)header[6] << 16) |
+		                  ((idx_t)header[7] << 24);
+
+		if (header_size < FIT_HEADER_SIZE_NO_CRC || data_size == 0) {
+			return false;
+		}
+		offset += header_size + data_size + 2;
+	}
+	return offset == size;
+}
+
+} // namespace duckdb
@@ -0,0 +1,52 @@
+#include "fit_sidecar.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <stdexcept>
+
+namespace duckdb {
+
+void FitSidecarWriter::Flush(const string &path) const {
+	// Unique per writer, concurrent scans may write the sidecar of the same file
+	static std::atomic<uint64_t> sequence {0};
+	auto now = std::chrono::steady_clock::now().time_since_epoch().count();
+	string temporary_path = path + ".tmp" + std::to_string((uint64_t)now) + "-" + std::to_string(sequence++);
+
+	{
+		std::ofstream file(temporary_path, std::ios::out | std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			throw std::runtime_error("Cannot write FIT sidecar: " + temporary_path);
+		}
+		file.write(reinterpret_cast<const char *>(contents.data()), (std::streamsize)contents.size());
+		if (!file.good()) {
+			file.close();
+			std::remove(temporary_path.c_str());
+			throw std::runtime_error("Cannot write FIT sidecar: " + temporary_path);
+		}
+	}
+
+#ifdef _WIN32
+	// rename does not replace an existing file on Windows
+	std::remove(path.c_str());
+#endif
+	if (std::rename(temporary_path.c_str(), path.c_str()) != 0) {
+		std::remove(temporary_path.c_str());
+		throw std::runtime_error("Cannot write FIT sidecar: " + path);
+	}
+}
+
+FitSidecarReader::FitSidecarReader(FileSystem &fs, const string &path) : file(fs, path), position(0) {
+}
+
+const_data_ptr_t FitSidecarReader::ReadData(idx_t size) {
+	if (size > file.GetSize() - position) {
+		throw std::runtime_error("FIT sidecar is truncated");
+	}
+	auto data = file.GetData() + position;
+	position += size;
+	return data;
+}
+
+} // namespace duckdb
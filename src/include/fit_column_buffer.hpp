@@ -0,0 +1,90 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include <vector>
+
+namespace duckdb {
+
+class FitSidecarReader;
+class FitSidecarWriter;
+
+/**
+ * Rows of fixed width columns stored column by column. Every value is kept in the
+ * physical type of the output column it is emitted to, with one validity bit per
+ * row, so rows are emitted into DuckDB vectors with one copy per column instead of
+ * one conversion per value.
+ */
+class FitColumnBuffer {
+public:
+	/**
+	 * @param widths Width in bytes of the values of every column
+	 */
+	explicit FitColumnBuffer(vector<idx_t> widths);
+
+	idx_t size() const {
+		return count;
+	}
+
+	/**
+	 * Appends a row with every value invalid
+	 * @return Index of the new row
+	 */
+	idx_t AppendRow();
+
+	/**
+	 * Marks the value of a column in a row valid
+	 * @param column Column index
+	 * @param row Row index
+	 * @return Where the value is stored, to be written with the column width
+	 */
+	data_ptr_t SetValid(idx_t column, idx_t row);
+
+	/**
+	 * @param column Column index
+	 * @param row Row index
+	 * @return Where the value is stored, nullptr if the value is invalid
+	 */
+	const_data_ptr_t GetValue(idx_t column, idx_t row) const;
+
+	/**
+	 * Copies rows of a column into a flat vector of the column type
+	 * @param column Column index
+	 * @param offset First row to copy
+	 * @param row_count Number of rows to copy
+	 * @param result Receives the values from its first row on
+	 */
+	void Scan(idx_t column, idx_t offset, idx_t row_count, Vector &result) const;
+
+	/**
+	 * @return Bytes allocated for the values and validity of all columns
+	 */
+	idx_t GetMemoryUsage() const;
+
+	/**
+	 * Writes the rows of every column
+	 * @param writer Receives the rows
+	 */
+	void Serialize(FitSidecarWriter &writer) const;
+
+	/**
+	 * Replaces the rows with rows written by Serialize from a buffer of the same widths
+	 * @param reader Holds the rows
+	 * @throws std::runtime_error if the rows were written with other widths
+	 */
+	void Deserialize(FitSidecarReader &reader);
+
+private:
+	static constexpr idx_t BITS_PER_ENTRY = 64;
+
+	static idx_t ValidityEntries(idx_t rows) {
+		return (rows + BITS_PER_ENTRY - 1) / BITS_PER_ENTRY;
+	}
+
+	vector<idx_t> widths;
+	idx_t count;
+	idx_t capacity;
+	std::vector<std::vector<data_t>> values;
+	std::vector<std::vector<uint64_t>> validity;
+};
+
+} // namespace duckdb
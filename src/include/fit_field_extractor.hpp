@@ -0,0 +1,135 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "fit_mesg.hpp"
+#include "fit_mesg_definition.hpp"
+
+namespace duckdb {
+
+/**
+ * Extracts a fixed list of fields of one global message into plain values, each
+ * being the profile scaled field value (raw / scale - offset). A field missing from
+ * a message is expanded from the components of another field when the profile
+ * defines one (e.g. enhanced_speed from speed), as the FIT decoder would do.
+ *
+ * An extraction plan is compiled once per definition message, mapping field offsets
+ * in the raw message data straight to output slots with the scale and offset folded
+ * in, so data messages are extracted without building fit::Mesg objects. Decoded
+ * messages are extracted with the same rules and give identical values.
+ *
+ * Filters on raw field values drop messages while they are extracted: the filtered
+ * fields are read first and compared as raw integers, before they are scaled, and a
+ * message is dropped at its first field out of range.
+ */
+class FitFieldExtractor {
+public:
+	/**
+	 * @param mesg_num Global message number of the extracted messages
+	 * @param field_nums Field definition number of every output slot
+	 */
+	FitFieldExtractor(FIT_UINT16 mesg_num, vector<FIT_UINT8> field_nums);
+
+	FIT_UINT16 GetMesgNum() const {
+		return mesg_num;
+	}
+
+	idx_t GetFieldCount() const {
+		return field_nums.size();
+	}
+
+	/**
+	 * Drops the messages whose raw value of a field is outside of a range, or that miss the field.
+	 * Must be called before the definitions are compiled.
+	 * @param slot Output slot of the field, not the timestamp
+	 * @param raw_min Smallest raw value kept, before scale and offset
+	 * @param raw_max Largest raw value kept, before scale and offset
+	 */
+	void AddFilter(idx_t slot, double raw_min, double raw_max);
+
+	/**
+	 * Only extracts fields present in the messages, none is expanded from the components of another
+	 * field. Must be called before the definitions are compiled.
+	 */
+	void SuppressComponentExpansion() {
+		expand_components = false;
+	}
+
+	/**
+	 * Range of the raw values of a field, those of its profile base type
+	 * @return False if the field is not an integer field of the profile
+	 */
+	static bool GetRawRange(FIT_UINT16 mesg_num, FIT_UINT8 field_num, double &raw_min, double &raw_max);
+
+	/**
+	 * Compiles the plan for a definition message, replacing the plan of its local message number
+	 * @param definition The definition message
+	 * @param big_endian True if the multi-byte values of the definition are big endian
+	 * @return False if data messages of this definition must be extracted from decoded messages
+	 */
+	bool Compile(const fit::MesgDefinition &definition, bool big_endian);
+
+	/**
+	 * Extracts a raw data message with the plan compiled for its local message number
+	 * @param local_num Local message number of the message
+	 * @param data Field data of the message
+	 * @param timestamp Timestamp of the message, or FIT_DATE_TIME_INVALID
+	 * @param values Receives GetFieldCount() values
+	 * @param valid Receives GetFieldCount() flags, false where the field is missing or invalid
+	 * @return False if the message is dropped by a filter, values and valid are incomplete then
+	 */
+	bool Extract(FIT_UINT8 local_num, const FIT_UINT8 *data, FIT_UINT32 timestamp, double *values,
+	             bool *valid) const;
+
+	/**
+	 * Extracts a decoded message
+	 * @param mesg The decoded message
+	 * @param values Receives GetFieldCount() values
+	 * @param valid Receives GetFieldCount() flags, false where the field is missing or invalid
+	 * @return False if the message is dropped by a filter, values and valid are incomplete then
+	 */
+	bool Extract(const fit::Mesg &mesg, double *values, bool *valid) const;
+
+private:
+	struct FieldRead {
+		idx_t slot;
+		FIT_UINT32 data_offset;
+		FIT_UINT8 type;
+		FIT_UINT8 size;
+		bool swap;
+		// Component expansion, bits is 0 for plain field values
+		FIT_UINT8 bit_offset;
+		FIT_UINT8 bits;
+		bool bits_signed;
+		double component_scale;
+		double component_offset;
+		// Output field
+		FIT_UINT8 target_type;
+		double scale;
+		double value_offset;
+		// Raw range kept by the filter of the slot
+		bool filtered;
+		double raw_min;
+		double raw_max;
+	};
+
+	struct FieldFilter {
+		idx_t slot;
+		double raw_min;
+		double raw_max;
+	};
+
+	// Sets the filter of the slot of a read
+	void ApplyFilter(FieldRead &read) const;
+	// True if every filtered slot was extracted
+	bool HasFilteredFields(const bool *valid) const;
+
+	FIT_UINT16 mesg_num;
+	vector<FIT_UINT8> field_nums;
+	idx_t timestamp_slot;
+	bool expand_components;
+	vector<FieldFilter> filters;
+	// Plan of every local message number, direct reads before expansions
+	vector<FieldRead> plans[FIT_MAX_LOCAL_MESGS];
+};
+
+} // namespace duckdb
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "duckdb/common/file_system.hpp"
+#include <vector>
+
+namespace duckdb {
+
+/**
+ * Read-only view of a whole FIT file as one contiguous byte span.
+ * Local regular files are memory mapped, or read with a single large read when mapping
+ * is not possible, so the decoder never goes through iostream. Files of other DuckDB
+ * file systems are read whole through their file handle.
+ */
+class FitFileBuffer {
+public:
+	/**
+	 * Opens the file through a DuckDB file system, so that remote and virtual files can be
+	 * decoded. Local files are still mapped, pipes are read to the end.
+	 * @param fs File system of the client context
+	 * @param path Path or URL of the FIT file
+	 * @throws std::exception if the file cannot be opened or read
+	 */
+	FitFileBuffer(FileSystem &fs, const string &path);
+	~FitFileBuffer();
+
+	FitFileBuffer(const FitFileBuffer &) = delete;
+	FitFileBuffer &operator=(const FitFileBuffer &) = delete;
+
+	const uint8_t *GetData() const {
+		return data;
+	}
+
+	idx_t GetSize() const {
+		return size;
+	}
+
+	/**
+	 * Verifies the file CRC of every FIT file in the buffer (chained files included)
+	 * in a single pass with the table-driven CRC kernel
+	 * @return False if a complete file in the buffer has a bad CRC. Truncated files
+	 * and files without a data size are left to the decoder to report.
+	 */
+	bool VerifyCrc() const;
+
+	/**
+	 * @return True if the buffer holds whole FIT files (chained files included) that declare their
+	 * data size, false if the last file is truncated or its size is unknown
+	 */
+	bool IsComplete() const;
+
+private:
+	// Maps a local regular file, false if the file is not one or if the path cannot be opened as is
+	bool Map(const string &path);
+	// Reads the whole file through its handle
+	void Read(FileHandle &handle);
+
+	const uint8_t *data;
+	idx_t size;
+	void *mapping;
+	std::vector<uint8_t> contents;
+};
+
+} // namespace duckdb
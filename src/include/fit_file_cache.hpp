@@ -0,0 +1,176 @@
+#pragma once
+
+#include "duckdb.hpp"
+
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace duckdb {
+
+/**
+ * Identifies the contents of a file on disk, a cached entry is stale once the
+ * size or the modification time of its file changes.
+ */
+struct FitFileKey {
+	string path;
+	idx_t size;
+	int64_t modified_time;
+
+	bool operator==(const FitFileKey &other) const {
+		return path == other.path && size == other.size && modified_time == other.modified_time;
+	}
+};
+
+struct FitFileCacheStats {
+	idx_t entries;
+	idx_t memory_usage;
+	idx_t memory_limit;
+	idx_t hits;
+	idx_t misses;
+	idx_t evictions;
+};
+
+/**
+ * Least recently used cache of decoded files with a memory budget. Entries are
+ * immutable and shared, a scan keeps the entry of the file it is emitting alive
+ * even after it was evicted. All methods are thread-safe.
+ */
+template <class T>
+class FitFileCache {
+public:
+	FitFileCache() : memory_usage(0), memory_limit(0), hits(0), misses(0), evictions(0) {
+	}
+
+	/**
+	 * @param key Path, size and modification time of the file
+	 * @return The cached entry, or nullptr if the file is not cached or has changed since
+	 */
+	shared_ptr<const T> Get(const FitFileKey &key) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto entry = entries.find(key.path);
+		if (entry == entries.end() || !(entry->second.key == key)) {
+			if (entry != entries.end()) {
+				Erase(entry);
+			}
+			misses++;
+			return nullptr;
+		}
+		lru.splice(lru.begin(), lru, entry->second.position);
+		hits++;
+		return entry->second.value;
+	}
+
+	/**
+	 * Caches an entry, replacing the entry of the same path and evicting the least
+	 * recently used entries until it fits. Entries larger than the budget are not cached.
+	 * @param key Path, size and modification time of the file
+	 * @param value The decoded file
+	 * @param memory Approximate size of the entry in bytes
+	 */
+	void Put(const FitFileKey &key, shared_ptr<const T> value, idx_t memory) {
+		std::lock_guard<std::mutex> guard(lock);
+		auto existing = entries.find(key.path);
+		if (existing != entries.end()) {
+			Erase(existing);
+		}
+		if (memory > memory_limit) {
+			return;
+		}
+		Evict(memory_limit - memory);
+
+		lru.push_front(key.path);
+		Entry entry {key, std::move(value), memory, lru.begin()};
+		entries.emplace(key.path, std::move(entry));
+		memory_usage += memory;
+	}
+
+	/**
+	 * Sets the memory budget, evicting entries until they fit in it
+	 * @param limit Budget in bytes, 0 disables the cache
+	 */
+	void SetMemoryLimit(idx_t limit) {
+		std::lock_guard<std::mutex> guard(lock);
+		memory_limit = limit;
+		Evict(memory_limit);
+	}
+
+	FitFileCacheStats GetStats() const {
+		std::lock_guard<std::mutex> guard(lock);
+		return {entries.size(), memory_usage, memory_limit, hits, misses, evictions};
+	}
+
+private:
+	struct Entry {
+		FitFileKey key;
+		shared_ptr<const T> value;
+		idx_t memory;
+		std::list<string>::iterator position;
+	};
+
+	void Erase(typename std::unordered_map<string, Entry>::iterator entry) {
+		memory_usage -= entry->second.memory;
+		lru.erase(entry->second.position);
+		entries.erase(entry);
+	}
+
+	// Evicts least recently used entries until at most limit bytes are used
+	void Evict(idx_t limit) {
+		while (memory_usage > limit && !lru.empty()) {
+			Erase(entries.find(lru.back()));
+			evictions++;
+		}
+	}
+
+	mutable std::mutex lock;
+	// Paths from the most to the least recently used
+	std::list<string> lru;
+	std::unordered_map<string, Entry> entries;
+	idx_t memory_usage;
+	idx_t memory_limit;
+	idx_t hits;
+	idx_t misses;
+	idx_t evictions;
+};
+
+/**
+ * Small facts about files, such as the time span of their records, remembered for every file
+ * decoded by the process so that later scans can skip files without opening them. Entries are
+ * a few bytes, the index forgets arbitrary entries beyond its capacity. All methods are thread-safe.
+ */
+template <class T>
+class FitFileIndex {
+public:
+	explicit FitFileIndex(idx_t capacity) : capacity(capacity) {
+	}
+
+	/**
+	 * @param key Path, size and modification time of the file
+	 * @param value Set to the fact about the file if it is known
+	 * @return False if the file is not indexed or has changed since
+	 */
+	bool Get(const FitFileKey &key, T &value) const {
+		std::lock_guard<std::mutex> guard(lock);
+		auto entry = entries.find(key.path);
+		if (entry == entries.end() || !(entry->second.first == key)) {
+			return false;
+		}
+		value = entry->second.second;
+		return true;
+	}
+
+	void Put(const FitFileKey &key, const T &value) {
+		std::lock_guard<std::mutex> guard(lock);
+		if (entries.size() >= capacity && entries.find(key.path) == entries.end()) {
+			entries.erase(entries.begin());
+		}
+		entries[key.path] = std::make_pair(key, value);
+	}
+
+private:
+	mutable std::mutex lock;
+	idx_t capacity;
+	std::unordered_map<string, std::pair<FitFileKey, T>> entries;
+};
+
+} // namespace duckdb
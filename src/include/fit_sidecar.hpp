@@ -0,0 +1,89 @@
+#pragma once
+
+#include "duckdb.hpp"
+#include "fit_file_buffer.hpp"
+
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace duckdb {
+
+/**
+ * Builds a sidecar file, the decoded rows of a FIT file kept on disk so that later
+ * scans read them back instead of decoding the FIT file again. Values are written
+ * in the byte order of the machine: a sidecar is read where it was written.
+ */
+class FitSidecarWriter {
+public:
+	template <class T>
+	void Write(const T &value) {
+		static_assert(std::is_trivially_copyable<T>::value, "sidecar values are copied byte by byte");
+		WriteData(reinterpret_cast<const_data_ptr_t>(&value), sizeof(T));
+	}
+
+	void WriteString(const string &value) {
+		Write<uint64_t>(value.size());
+		WriteData(reinterpret_cast<const_data_ptr_t>(value.data()), value.size());
+	}
+
+	void WriteData(const_data_ptr_t data, idx_t size) {
+		contents.insert(contents.end(), data, data + size);
+	}
+
+	/**
+	 * Writes the sidecar through a temporary file that is renamed into place, so that
+	 * a concurrent reader never sees a partial sidecar
+	 * @param path Path of the sidecar
+	 * @throws std::runtime_error if the sidecar cannot be written
+	 */
+	void Flush(const string &path) const;
+
+private:
+	std::vector<data_t> contents;
+};
+
+/**
+ * Reads back a sidecar written by FitSidecarWriter from a memory mapping of the file.
+ */
+class FitSidecarReader {
+public:
+	/**
+	 * @param fs File system of the client context
+	 * @param path Path of the sidecar
+	 * @throws std::exception if the sidecar cannot be opened
+	 */
+	FitSidecarReader(FileSystem &fs, const string &path);
+
+	/**
+	 * @throws std::runtime_error past the end of the sidecar, as for every read
+	 */
+	template <class T>
+	T Read() {
+		static_assert(std::is_trivially_copyable<T>::value, "sidecar values are copied byte by byte");
+		T value;
+		memcpy(&value, ReadData(sizeof(T)), sizeof(T));
+		return value;
+	}
+
+	string ReadString() {
+		auto size = Read<uint64_t>();
+		auto data = ReadData(size);
+		return string(reinterpret_cast<const char *>(data), size);
+	}
+
+	/**
+	 * @return The next size bytes of the sidecar, valid as long as the reader
+	 */
+	const_data_ptr_t ReadData(idx_t size);
+
+	idx_t Remaining() const {
+		return file.GetSize() - position;
+	}
+
+private:
+	FitFileBuffer file;
+	idx_t position;
+};
+
+} // namespace duckdb